@@ -59,26 +59,38 @@ public:
 
     /// Compute optimal solution and return value of objective function
     /// If the input feature map is empty, a warning is issued and -1 is returned.
+    /// The edge graph is split into its connected components. Components with only a few
+    /// combinations of charge variants are solved by enumeration, all others are packed into
+    /// bins which are solved by the ILP (in parallel, largest bins first).
     /// @return value of objective function
-    /// and @p pairs will have all realized edges set to "active"
-    DoubleReal compute(const FeatureMap<> fm, PairsType & pairs, Size verbose_level) const;
+    /// and @p pairs will have all realized edges set to "active" (@p pairs is reordered by component)
+    DoubleReal compute(const FeatureMap<> & fm, PairsType & pairs, Size verbose_level) const;
 
 private:
 
     /// slicing the problem into subproblems
-    DoubleReal computeSlice_(const FeatureMap<> fm,
+    DoubleReal computeSlice_(const FeatureMap<> & fm,
                              PairsType & pairs,
                              const PairsIndex margin_left,
                              const PairsIndex margin_right,
                              const Size verbose_level) const;
 
     /// slicing the problem into subproblems
-    DoubleReal computeSliceOld_(const FeatureMap<> fm,
+    DoubleReal computeSliceOld_(const FeatureMap<> & fm,
                                 PairsType & pairs,
                                 const PairsIndex margin_left,
                                 const PairsIndex margin_right,
                                 const Size verbose_level) const;
 
+    /// solves the components in [margin_left, margin_right) by trying all combinations of charge variants
+    DoubleReal computeSliceByEnumeration_(const FeatureMap<> & fm,
+                                          PairsType & pairs,
+                                          const PairsIndex margin_left,
+                                          const PairsIndex margin_right) const;
+
+    /// returns the root of feature @p f in the union-find forest @p parent
+    static Size findRoot_(std::vector<Size> & parent, Size f);
+
     /// calculate a score for the i_th edge
     DoubleReal getLogScore_(const PairsType::value_type & pair, const FeatureMap<> & fm) const;
 
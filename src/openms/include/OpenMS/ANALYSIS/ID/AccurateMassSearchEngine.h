@@ -159,6 +159,21 @@ namespace OpenMS
     };
 
 
+    /**
+      @brief Searches feature and consensus maps against the HMDB mass table
+
+      The mass table, the structure mapping and the adduct list are parsed on
+      first use and kept until the adduct parameters change, so repeated
+      calls of run() do not read the files again. The adducts are parsed into
+      linear m/z-to-neutral-mass shifts once.
+
+      run() collects the adduct-shifted neutral masses of all features of a
+      map, sorts them and resolves them against the (sorted) mass table in a
+      single merged sweep. The hits of each feature are then turned into
+      AccurateMassSearchResult objects (and scored by isotope similarity) in
+      parallel if OpenMP is enabled. The order of the results is the same as
+      for a sequential search.
+    */
     class OPENMS_DLLAPI AccurateMassSearchEngine :
     public DefaultParamHandler,
     public ProgressLogger
@@ -186,7 +201,55 @@ protected:
     virtual void updateMembers_();
 
 private:
+    /// Adduct with its m/z-to-neutral-mass shift (neutral mass = mz * mass_factor + mass_offset)
+    struct AdductInfo_
+    {
+      String name;
+      DoubleReal charge;
+      DoubleReal mass_factor;
+      DoubleReal mass_offset;
+    };
+
+    /// Neutral query mass of one feature/adduct combination and its hits [first_hit, last_hit) in masskey_table_
+    struct MassQuery_
+    {
+      DoubleReal mass;
+      Size adduct;
+      Size first_hit;
+      Size last_hit;
+    };
+
+    /// Compares the masses of two queries (given by their indices)
+    struct MassQueryLess_
+    {
+      explicit MassQueryLess_(const std::vector<MassQuery_>& queries) :
+        queries_(queries)
+      {
+      }
+
+      bool operator()(Size a, Size b) const
+      {
+        return queries_[a].mass < queries_[b].mass;
+      }
+
+      const std::vector<MassQuery_>& queries_;
+    };
+
     /// private member functions
+
+    /// Parses the mapping files and the adducts if needed
+    void init_();
+    /// Builds the queries of all (m/z, charge) pairs and resolves them in one sweep over masskey_table_; the queries of pair i are [query_offsets[i], query_offsets[i + 1])
+    void searchMasses_(const std::vector<DoubleReal>& mzs, const std::vector<DoubleReal>& charges, std::vector<MassQuery_>& queries, std::vector<Size>& query_offsets) const;
+    /// Appends the adducts searched for the given m/z and charge to @p queries (without hits)
+    void addQueries_(const DoubleReal& adduct_mass, const DoubleReal& adduct_charge, std::vector<MassQuery_>& queries) const;
+    /// Appends one result per hit of the queries [first, last) to @p results
+    void addResults_(const std::vector<MassQuery_>& queries, Size first, Size last, const DoubleReal& adduct_mass, const DoubleReal& adduct_charge, std::vector<AccurateMassSearchResult>& results) const;
+    /// Returns the mass tolerance (in Da) around @p neutral_query_mass
+    DoubleReal getMassTolerance_(const DoubleReal& neutral_query_mass) const;
+    /// Intensities of the consensus feature in each of the @p number_of_maps maps (0 if missing)
+    static void getIndividualIntensities_(const ConsensusFeature&, const Size& number_of_maps, std::vector<DoubleReal>& intensities);
+
     void parseMappingFile_(const String&);
     void parseStructMappingFile_(const String&);
     void parseAdductsFile_(const String&);
@@ -223,6 +286,14 @@ private:
 
     StringList pos_adducts_;
     StringList neg_adducts_;
+
+    /// parsed adducts of the current ionization mode
+    std::vector<AdductInfo_> adducts_;
+
+    /// the mapping files are parsed on first use
+    bool db_loaded_;
+    /// the adducts are parsed on first use and again after the parameters changed
+    bool adducts_loaded_;
   };
 
 
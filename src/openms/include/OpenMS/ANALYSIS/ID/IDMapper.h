@@ -38,6 +38,7 @@
 #include <OpenMS/KERNEL/MSExperiment.h>
 #include <OpenMS/KERNEL/FeatureMap.h>
 #include <OpenMS/KERNEL/ConsensusMap.h>
+#include <OpenMS/KERNEL/FeatureTable.h>
 #include <OpenMS/CONCEPT/LogStream.h>
 
 #include <OpenMS/DATASTRUCTURES/DoubleList.h>
@@ -174,13 +175,126 @@ public:
       // append protein identifications
       map.getProteinIdentifications().insert(map.getProteinIdentifications().end(), protein_ids.begin(), protein_ids.end());
 
+      FeatureMapAccessor_<FeatureType> accessor(map);
+      annotateFeatures_(accessor, ids, use_centroid_rt, use_centroid_mz);
+
+      LOG_INFO << map.getAnnotationStatistics() << std::endl;
+    }
+
+    /**
+        @brief Mapping method for feature tables
+
+        Works like the method for feature maps (see there), but on the compact FeatureTable representation.
+
+        @param map FeatureTable to receive the identifications
+        @param ids PeptideIdentification for the features
+        @param protein_ids ProteinIdentification for the table
+        @param use_centroid_rt Whether to use the RT value of feature centroids even if convex hulls are present
+        @param use_centroid_mz Whether to use the m/z value of feature centroids even if convex hulls are present
+
+        @exception Exception::MissingInformation is thrown if the MetaInfoInterface of @p ids does not contain "MZ" and "RT"
+    */
+    void annotate(FeatureTable & map, const std::vector<PeptideIdentification> & ids, const std::vector<ProteinIdentification> & protein_ids, bool use_centroid_rt = false, bool use_centroid_mz = false);
+
+    /**
+        @brief Mapping method for consensus maps
+
+      If several consensus features lie inside the allowed deviation, the peptide identifications
+      are mapped to all the consensus features.
+
+      @param map ConsensusMap to receive the identifications
+      @param ids PeptideIdentification for the ConsensusFeatures
+      @param protein_ids ProteinIdentification for the ConsensusMap
+      @param measure_from_subelements Do distance estimate from FeatureHandles instead of Centroid
+
+        @exception Exception::MissingInformation is thrown if the MetaInfoInterface of @p ids does not contain 'MZ' and 'RT'
+    */
+    void annotate(ConsensusMap & map, const std::vector<PeptideIdentification> & ids, const std::vector<ProteinIdentification> & protein_ids, bool measure_from_subelements = false);
+
+protected:
+    /**
+        @brief Index-based access to the features of a FeatureMap, with the interface of FeatureTable
+
+        Lets annotateFeatures_() work on both representations.
+    */
+    template <typename FeatureType>
+    class FeatureMapAccessor_
+    {
+public:
+      explicit FeatureMapAccessor_(FeatureMap<FeatureType> & map) :
+        map_(map)
+      {
+      }
+
+      Size size() const
+      {
+        return map_.size();
+      }
+
+      DoubleReal getRT(Size index) const
+      {
+        return map_[index].getRT();
+      }
+
+      DoubleReal getMZ(Size index) const
+      {
+        return map_[index].getMZ();
+      }
+
+      Int getCharge(Size index) const
+      {
+        return map_[index].getCharge();
+      }
+
+      Size getNumberOfConvexHulls(Size index) const
+      {
+        return map_[index].getConvexHulls().size();
+      }
+
+      DBoundingBox<2> getBoundingBox(Size index) const
+      {
+        return map_[index].getConvexHull().getBoundingBox();
+      }
+
+      DBoundingBox<2> getConvexHullBoundingBox(Size index, Size hull_index) const
+      {
+        return map_[index].getConvexHulls()[hull_index].getBoundingBox();
+      }
+
+      std::vector<PeptideIdentification> & getPeptideIdentifications(Size index)
+      {
+        return map_[index].getPeptideIdentifications();
+      }
+
+      std::vector<PeptideIdentification> & getUnassignedPeptideIdentifications()
+      {
+        return map_.getUnassignedPeptideIdentifications();
+      }
+
+      const std::vector<DataProcessing> & getDataProcessing() const
+      {
+        return map_.getDataProcessing();
+      }
+
+private:
+      FeatureMap<FeatureType> & map_;
+    };
+
+    /**
+        @brief Matches the peptide identifications @p ids to the features of @p map (see annotate() for feature maps)
+
+        @p map is a FeatureTable or a FeatureMapAccessor_.
+    */
+    template <typename MapType>
+    void annotateFeatures_(MapType & map, const std::vector<PeptideIdentification> & ids, bool use_centroid_rt, bool use_centroid_mz)
+    {
       // check if all features have at least one convex hull
       // if not, use the centroid and the given tolerances
       if (!(use_centroid_rt && use_centroid_mz))
       {
-        for (typename FeatureMap<FeatureType>::Iterator f_it = map.begin(); f_it != map.end(); ++f_it)
+        for (Size i = 0; i < map.size(); ++i)
         {
-          if (f_it->getConvexHulls().empty())
+          if (map.getNumberOfConvexHulls(i) == 0)
           {
             use_centroid_rt = true;
             use_centroid_mz = true;
@@ -204,23 +318,22 @@ public:
                  max_rt = -std::numeric_limits<DoubleReal>::max();
       // std::cout << "Precomputing bounding boxes..." << std::endl;
       boxes.reserve(map.size());
-      for (typename FeatureMap<FeatureType>::Iterator f_it = map.begin();
-           f_it != map.end(); ++f_it)
+      for (Size i = 0; i < map.size(); ++i)
       {
         DBoundingBox<2> box;
         if (!(use_centroid_rt && use_centroid_mz))
         {
-          box = f_it->getConvexHull().getBoundingBox();
+          box = map.getBoundingBox(i);
         }
         if (use_centroid_rt)
         {
-          box.setMinX(f_it->getRT());
-          box.setMaxX(f_it->getRT());
+          box.setMinX(map.getRT(i));
+          box.setMaxX(map.getRT(i));
         }
         if (use_centroid_mz)
         {
-          box.setMinY(f_it->getMZ());
-          box.setMaxY(f_it->getMZ());
+          box.setMinY(map.getMZ(i));
+          box.setMaxY(map.getMZ(i));
         }
         increaseBoundingBox_(box);
         boxes.push_back(box);
@@ -289,13 +402,14 @@ public:
                hash_table[index].begin(); hash_it != hash_table[index].end();
              ++hash_it)
         {
-          Feature & feat = map[*hash_it];
+          const Size feat = *hash_it;
+          const Int feat_charge = map.getCharge(feat);
 
           // need to check the charge state?
           bool check_charge = !ignore_charge_;
           if (check_charge && (mz_values.size() == 1))               // check now
           {
-            if (!charges.contains(feat.getCharge())) continue;
+            if (!charges.contains(feat_charge)) continue;
             check_charge = false;                 // don't need to check later
           }
 
@@ -304,41 +418,39 @@ public:
           for (DoubleList::iterator mz_it = mz_values.begin();
                mz_it != mz_values.end(); ++mz_it, ++index)
           {
-            if (check_charge && (charges[index] != feat.getCharge()))
+            if (check_charge && (charges[index] != feat_charge))
             {
               continue;                   // charge states need to match
             }
 
             DPosition<2> id_pos(rt_value, *mz_it);
-            if (boxes[*hash_it].encloses(id_pos))                 // potential match
+            if (boxes[feat].encloses(id_pos))                 // potential match
             {
               if (use_centroid_mz)
               {
                 // only one m/z value to check, which was alredy incorporated
                 // into the overall bounding box -> success!
-                feat.getPeptideIdentifications().push_back(*id_it);
+                map.getPeptideIdentifications(feat).push_back(*id_it);
                 ++matching_features;
                 break;                     // "mz_it" loop
               }
               // else: check all the mass traces
               bool found_match = false;
-              for (std::vector<ConvexHull2D>::iterator ch_it =
-                     feat.getConvexHulls().begin(); ch_it !=
-                   feat.getConvexHulls().end(); ++ch_it)
+              for (Size hull = 0; hull < map.getNumberOfConvexHulls(feat); ++hull)
               {
-                DBoundingBox<2> box = ch_it->getBoundingBox();
+                DBoundingBox<2> box = map.getConvexHullBoundingBox(feat, hull);
                 if (use_centroid_rt)
                 {
-                  box.setMinX(feat.getRT());
-                  box.setMaxX(feat.getRT());
+                  box.setMinX(map.getRT(feat));
+                  box.setMaxX(map.getRT(feat));
                 }
                 increaseBoundingBox_(box);
                 if (box.encloses(id_pos))                     // success!
                 {
-                  feat.getPeptideIdentifications().push_back(*id_it);
+                  map.getPeptideIdentifications(feat).push_back(*id_it);
                   ++matching_features;
                   found_match = true;
-                  break;                       // "ch_it" loop
+                  break;                       // "hull" loop
                 }
               }
               if (found_match) break;                   // "mz_it" loop
@@ -357,28 +469,9 @@ public:
       // some statistics output
       LOG_INFO << "Unassigned peptides: " << matches_none << "\n"
                << "Peptides assigned to exactly one feature: " << matches_single << "\n"
-               << "Peptides assigned to multiple features: " << matches_multi << "\n"
-               << map.getAnnotationStatistics()
-               << std::endl;
-
+               << "Peptides assigned to multiple features: " << matches_multi << std::endl;
     }
 
-    /**
-        @brief Mapping method for consensus maps
-
-      If several consensus features lie inside the allowed deviation, the peptide identifications
-      are mapped to all the consensus features.
-
-      @param map ConsensusMap to receive the identifications
-      @param ids PeptideIdentification for the ConsensusFeatures
-      @param protein_ids ProteinIdentification for the ConsensusMap
-      @param measure_from_subelements Do distance estimate from FeatureHandles instead of Centroid
-
-        @exception Exception::MissingInformation is thrown if the MetaInfoInterface of @p ids does not contain 'MZ' and 'RT'
-    */
-    void annotate(ConsensusMap & map, const std::vector<PeptideIdentification> & ids, const std::vector<ProteinIdentification> & protein_ids, bool measure_from_subelements = false);
-
-protected:
     void updateMembers_();
 
     ///Allowed RT deviation
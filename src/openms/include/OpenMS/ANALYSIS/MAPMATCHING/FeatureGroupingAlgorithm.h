@@ -38,6 +38,7 @@
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
 #include <OpenMS/KERNEL/FeatureMap.h>
 #include <OpenMS/KERNEL/ConsensusMap.h>
+#include <OpenMS/KERNEL/FeatureTable.h>
 
 namespace OpenMS
 {
@@ -65,6 +66,11 @@ public:
     /// as the base implementation will forward the data to the FeatureMap version of group()
     virtual void group(const std::vector<ConsensusMap> & maps, ConsensusMap & out);
 
+    ///Applies the algorithm. The features in the input feature tables @p maps are grouped and the output is written to the consensus map @p out
+    /// The base implementation converts the tables to FeatureMaps and calls the FeatureMap version of group().
+    /// Algorithms that only need the positions, intensities etc. of the features should override this method to avoid the conversion.
+    virtual void group(const std::vector<FeatureTable> & maps, ConsensusMap & out);
+
     /// Transfers subelements (grouped features) from input consensus maps to the result consensus map
     void transferSubelements(const std::vector<ConsensusMap> & maps, ConsensusMap & out) const;
 
@@ -74,6 +74,15 @@ public:
     virtual void group(const std::vector<ConsensusMap> & maps,
                        ConsensusMap & out);
 
+    /**
+        @brief Applies the algorithm to feature tables
+
+        The tables are converted to (singleton) consensus maps, which gives the same result as the FeatureMap version with a fraction of the memory.
+        @exception IllegalArgument is thrown if less than two input maps are given.
+    */
+    virtual void group(const std::vector<FeatureTable> & maps,
+                       ConsensusMap & out);
+
     /// Creates a new instance of this class (for Factory)
     static FeatureGroupingAlgorithm * create()
     {
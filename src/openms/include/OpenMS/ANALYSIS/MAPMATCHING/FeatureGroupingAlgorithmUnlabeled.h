@@ -95,6 +95,13 @@ public:
     */
     virtual void group(const std::vector<FeatureMap<> > & maps, ConsensusMap & out);
 
+    /**
+        @brief Applies the algorithm to feature tables (without converting them to FeatureMaps)
+
+        @exception IllegalArgument is thrown if less than two input maps are given.
+    */
+    virtual void group(const std::vector<FeatureTable> & maps, ConsensusMap & out);
+
     /**
         @brief Adds one map to the group
 
@@ -134,6 +141,10 @@ private:
     /// Assignment operator intentionally not implemented -> private
     FeatureGroupingAlgorithmUnlabeled & operator=(const FeatureGroupingAlgorithmUnlabeled &);
 
+    /// Applies the algorithm to feature maps or feature tables
+    template <typename MapType>
+    void group_(const std::vector<MapType> & maps, ConsensusMap & out);
+
   };
 
 } // namespace OpenMS
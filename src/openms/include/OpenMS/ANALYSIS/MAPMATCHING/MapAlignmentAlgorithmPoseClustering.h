@@ -75,6 +75,7 @@ public:
     void align(const FeatureMap<> & map, TransformationDescription & trafo);
     void align(const MSExperiment<> & map, TransformationDescription & trafo);
     void align(const ConsensusMap & map, TransformationDescription & trafo);
+    void align(const FeatureTable & map, TransformationDescription & trafo);
 
     template <typename MapType>
     void setReference(const MapType & map)
@@ -37,6 +37,10 @@
 #define OPENMS_ANALYSIS_MAPMATCHING_POSECLUSTERINGAFFINESUPERIMPOSER_H
 
 #include <OpenMS/ANALYSIS/MAPMATCHING/BaseSuperimposer.h>
+#include <OpenMS/DATASTRUCTURES/ConstRefVector.h>
+#include <OpenMS/MATH/MISC/LinearInterpolation.h>
+
+#include <iosfwd>
 
 namespace OpenMS
 {
@@ -104,6 +108,50 @@ public:
       return "poseclustering_affine";
     }
 
+protected:
+
+    typedef ConstRefVector<ConsensusMap> PeakPointerArray_;
+    typedef Math::LinearInterpolation<DoubleReal, DoubleReal> LinearInterpolationType_;
+
+    /// m/z neighborhood of an element of the model map (see hashPairs_())
+    struct MZWindow_
+    {
+      /// First element of the scene map within the m/z tolerance
+      Size scene_begin;
+      /// One past the last element of the scene map within the m/z tolerance
+      Size scene_end;
+      /// Weight derived from the number of model map elements within the m/z tolerance (not used if <= 0)
+      DoubleReal model_factor;
+      /// Weight derived from the number of scene map elements within the m/z tolerance (not used if <= 0)
+      DoubleReal scene_factor;
+    };
+
+    /**
+      @brief Computes the m/z windows for all elements of the model map.
+
+      Both maps have to be sorted by m/z.
+    */
+    void computeMZWindows_(const PeakPointerArray_ & model_map, const PeakPointerArray_ & scene_map,
+                           DoubleReal mz_pair_max_distance, std::vector<MZWindow_> & windows) const;
+
+    /**
+      @brief Hashes the transformations of pairs of model map elements onto pairs of scene map elements.
+
+      In the first round (@p rt_low_hash and @p rt_high_hash are null), only the scaling is hashed.
+      In the second round, only scalings in [@p scale_low, @p scale_high] are hashed, together with the images of @p rt_low and @p rt_high.
+
+      The pairs are distributed over a fixed number of blocks which are processed in parallel (if OpenMP is enabled) and merged in order, so the result does not depend on the number of threads.
+      If @p num_votes is positive and there are more candidate pairs, at most @p num_votes randomly sampled votes are hashed instead (with weights corrected for the sampling).
+      Fewer votes are hashed if drawing gives up after 100 times as many draws as votes requested, because almost all drawn pairs were rejected (e.g. by the RT distance or scaling limits).
+
+      If @p dump_pairs is not null, all hashed pairs are written to it (this disables parallelization).
+    */
+    void hashPairs_(const PeakPointerArray_ & model_map, const PeakPointerArray_ & scene_map, const std::vector<MZWindow_> & windows,
+                    DoubleReal total_intensity_ratio, DoubleReal rt_pair_min_distance, Size num_votes,
+                    DoubleReal scale_low, DoubleReal scale_high, DoubleReal rt_low, DoubleReal rt_high,
+                    LinearInterpolationType_ & scaling_hash, LinearInterpolationType_ * rt_low_hash, LinearInterpolationType_ * rt_high_hash,
+                    std::ostream * dump_pairs, UInt progress_begin, UInt progress_end);
+
   };
 } // namespace OpenMS
 
@@ -45,6 +45,8 @@
 
 #include <boost/unordered_map.hpp>
 
+#include <queue>
+
 namespace OpenMS
 {
 
@@ -70,8 +72,9 @@ namespace OpenMS
 
      This algorithm includes a number of optimizations to reduce run-time:
      @li two-dimensional hashing of features,
-     @li a look-up table for feature distances,
-     @li a variant of QT clustering that requires only one round of clustering.
+     @li parallel construction of the initial clusters (if OpenMP is enabled),
+     @li a variant of QT clustering that requires only one round of clustering,
+     @li a priority queue of clusters, so that only clusters affected by an extraction are re-evaluated.
 
      @see FeatureGroupingAlgorithmQT
 
@@ -85,11 +88,21 @@ namespace OpenMS
   {
 private:
 
-    /// Distances between pairs of grid features
-    typedef OpenMSBoost::unordered_map<std::pair<GridFeature *, GridFeature *>, DoubleReal> PairDistances;
-
     typedef HashGrid<GridFeature *> Grid;
 
+    /**
+         @brief Entry of the cluster priority queue: (quality, -index of the cluster)
+
+         The natural ordering of the pairs makes the top of a max-heap the cluster with the highest quality and, among equal qualities, the lowest index.
+    */
+    typedef std::pair<DoubleReal, SignedSize> QueueEntry;
+
+    /// Max-heap of clusters (entries become stale when a cluster changes and are skipped lazily)
+    typedef std::priority_queue<QueueEntry> ClusterQueue;
+
+    /// Mapping: grid feature -> clusters that contain it as a neighbor
+    typedef OpenMSBoost::unordered_map<GridFeature *, std::vector<Size> > ElementMapping;
+
     /// Number of input maps
     Size num_maps_;
 
@@ -105,19 +118,12 @@ private:
     /// Feature distance functor
     FeatureDistance feature_distance_;
 
-    /**
-         @brief Distance map.
-
-         To compute it only once, the distance between two features is accessible by searching for a pair where the first position is the smaller pointer value.
-     */
-    PairDistances distances_;
-
     /**
          @brief Calculates the distance between two grid features.
 
-         The distance is looked up in the distance map and only computed (and stored) if it's not already available.
-     */
-    DoubleReal getDistance_(GridFeature * left, GridFeature * right);
+         @p left has to be the feature that comes first in the grid (see @p computeClustering_), so that both clusters involved see exactly the same distance value.
+    */
+    DoubleReal getDistance_(FeatureDistance & feature_distance, GridFeature * left, GridFeature * right) const;
 
     /**
          @brief Checks whether the peptide IDs of a cluster and a neighboring feature are compatible.
@@ -129,13 +135,17 @@ private:
     /// Sets algorithm parameters
     void setParameters_(DoubleReal max_intensity, DoubleReal max_mz);
 
-    /// Generates a consensus feature from the best cluster and updates the clustering
-    void makeConsensusFeature_(std::list<QTCluster> & clustering,
-           ConsensusFeature & feature, OpenMSBoost::unordered_map<GridFeature *,
-             std::vector< QTCluster * > > & element_mapping);
+    /**
+         @brief Generates a consensus feature from the best cluster and updates the clustering
+
+         @return False if there are no valid clusters left
+    */
+    bool makeConsensusFeature_(std::vector<QTCluster> & clustering,
+                               ClusterQueue & queue, ConsensusFeature & feature,
+                               const ElementMapping & element_mapping);
 
-    /// Computes an initial QT clustering of the points in the hash grid
-    void computeClustering_(Grid & grid, std::list<QTCluster> & clustering);
+    /// Computes an initial QT clustering of the points in the hash grid (one cluster per grid feature, in grid order)
+    void computeClustering_(Grid & grid, std::vector<QTCluster> & clustering);
 
     /// Runs the algorithm on feature maps or consensus maps
     template <typename MapType>
@@ -134,6 +134,17 @@ public:
                              double& dotprod, double& manhattan);
     //@}
 
+    /**
+      @brief m/z windows of a spectrum that are read by the DIA scores
+
+      Returns (start, end) m/z pairs covering all regions of a spectrum that the
+      scores above read for the given transitions and the b/y ions (of the
+      given charge) of @p sequence. A spectrum only needs to be known inside
+      these windows to compute the scores (see SpectrumAddition::addUpSpectra).
+    */
+    void getScoringWindows(const std::vector<TransitionType>& transitions, AASequence& sequence,
+                           int by_charge_state, std::vector<std::pair<double, double> >& windows);
+
 private:
 
     /// Copy constructor (algorithm class)
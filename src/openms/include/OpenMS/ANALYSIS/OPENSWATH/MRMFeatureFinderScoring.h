@@ -68,6 +68,7 @@
 
 // auxiliary
 #include <OpenMS/ANALYSIS/OPENSWATH/SpectrumAddition.h>
+#include <OpenMS/CHEMISTRY/ResidueDB.h>
 
 #include <boost/shared_ptr.hpp>
 #include <boost/make_shared.hpp>
@@ -403,14 +404,29 @@ var_yseries_score   -0.0327896378737766
     DoubleReal spacing_for_spectra_resampling_;
     OpenSwath_Scores_Usage su_;
 
+    /// Spectra fetched from spectrum_cache_map_ (by index), shared by all peak groups scored with this object
+    std::map<int, OpenSwath::SpectrumPtr> spectrum_cache_;
+    const OpenSwath::ISpectrumAccess* spectrum_cache_map_;
+    Size spectrum_cache_size_;
+
   public:
 
+    /// Constructor
+    ChromatographicScorer() :
+      rt_normalization_factor_(1.0),
+      add_up_spectra_(1),
+      spacing_for_spectra_resampling_(0.005),
+      spectrum_cache_map_(0),
+      spectrum_cache_size_(64)
+    {
+    }
+
     /**
     @brief Initialize the scoring object
     */
     void initialize(DoubleReal rt_normalization_factor_,
       int add_up_spectra_, DoubleReal spacing_for_spectra_resampling_,
-      OpenSwath_Scores_Usage & su_)
+      const OpenSwath_Scores_Usage & su_)
     {
       this->rt_normalization_factor_ = rt_normalization_factor_;
       this->add_up_spectra_ = add_up_spectra_;
@@ -529,8 +545,15 @@ var_yseries_score   -0.0327896378737766
       // parameters
       int by_charge_state = 1; // for which charge states should we check b/y series
 
+      OpenMS::AASequence aas;
+      OpenSwathDataAccessHelper::convertPeptideToAASequence(pep, aas);
+
+      // the added spectra are only needed where the scores look at them
+      std::vector<std::pair<double, double> > mz_windows;
+      diascoring.getScoringWindows(transitions, aas, by_charge_state, mz_windows);
+
       // find spectrum that is closest to the apex of the peak using binary search
-      OpenSwath::SpectrumPtr spectrum_ = getAddedSpectra_(swath_map, imrmfeature->getRT(), add_up_spectra_);
+      OpenSwath::SpectrumPtr spectrum_ = getAddedSpectra_(swath_map, imrmfeature->getRT(), add_up_spectra_, mz_windows);
       OpenSwath::SpectrumPtr* spectrum = &spectrum_;
 
       // Isotope correlation / overlap score: Is this peak part of an
@@ -542,8 +565,6 @@ var_yseries_score   -0.0327896378737766
           scores.massdev_score, scores.weighted_massdev_score);
 
       // Presence of b/y series score
-      OpenMS::AASequence aas;
-      OpenSwathDataAccessHelper::convertPeptideToAASequence(pep, aas);
       diascoring.dia_by_ion_score((*spectrum), aas, by_charge_state, scores.bseries_score, scores.yseries_score);
 
       // FEATURE we should not punish so much when one transition is missing!
@@ -579,6 +600,31 @@ var_yseries_score   -0.0327896378737766
 
     /// Returns the addition of "nr_spectra_to_add" spectra around the given RT
     OpenSwath::SpectrumPtr getAddedSpectra_(OpenSwath::SpectrumAccessPtr swath_map, double RT, int nr_spectra_to_add)
+    {
+      std::vector<OpenSwath::SpectrumPtr> all_spectra;
+      getSpectraAround_(swath_map, RT, nr_spectra_to_add, all_spectra);
+      if (nr_spectra_to_add == 1)
+      {
+        return all_spectra[0];
+      }
+      return SpectrumAddition::addUpSpectra(all_spectra, spacing_for_spectra_resampling_, true);
+    }
+
+    /// Returns the addition of "nr_spectra_to_add" spectra around the given RT, computed only inside the given m/z windows
+    OpenSwath::SpectrumPtr getAddedSpectra_(OpenSwath::SpectrumAccessPtr swath_map, double RT, int nr_spectra_to_add,
+                                            const std::vector<std::pair<double, double> >& mz_windows)
+    {
+      std::vector<OpenSwath::SpectrumPtr> all_spectra;
+      getSpectraAround_(swath_map, RT, nr_spectra_to_add, all_spectra);
+      if (nr_spectra_to_add == 1)
+      {
+        return all_spectra[0];
+      }
+      return SpectrumAddition::addUpSpectra(all_spectra, mz_windows, spacing_for_spectra_resampling_, true);
+    }
+
+    /// Returns the spectrum closest to the given RT and, if "nr_spectra_to_add" is larger than one, its neighbours
+    void getSpectraAround_(OpenSwath::SpectrumAccessPtr swath_map, double RT, int nr_spectra_to_add, std::vector<OpenSwath::SpectrumPtr>& all_spectra)
     {
       std::vector<std::size_t> indices = swath_map->getSpectraByRT(RT, 0.0);
       int closest_idx = boost::numeric_cast<int>(indices[0]);
@@ -589,24 +635,56 @@ var_yseries_score   -0.0327896378737766
         closest_idx--;
       }
 
-      if (nr_spectra_to_add == 1)
+      all_spectra.clear();
+      // always add the spectrum 0, then add those right and left
+      all_spectra.push_back(getSpectrum_(swath_map, closest_idx));
+      if (nr_spectra_to_add != 1)
+      {
+        for (int i = 1; i <= nr_spectra_to_add / 2; i++) // cast to int is intended!
+        {
+          all_spectra.push_back(getSpectrum_(swath_map, closest_idx - i));
+          all_spectra.push_back(getSpectrum_(swath_map, closest_idx + i));
+        }
+      }
+    }
+
+    /**
+      @brief Returns spectrum @p id of @p swath_map, reusing recently fetched spectra
+
+      Peak groups in the same SWATH map and RT neighbourhood use the same
+      spectra; these are only read (and converted) once. If the cache is full,
+      the spectrum farthest away from @p id is dropped.
+    */
+    OpenSwath::SpectrumPtr getSpectrum_(OpenSwath::SpectrumAccessPtr swath_map, int id)
+    {
+      if (swath_map.get() != spectrum_cache_map_)
       {
-        OpenSwath::SpectrumPtr spectrum_ = swath_map->getSpectrumById(closest_idx);
-        return spectrum_;
+        spectrum_cache_.clear();
+        spectrum_cache_map_ = swath_map.get();
       }
-      else
+
+      std::map<int, OpenSwath::SpectrumPtr>::iterator cache_it = spectrum_cache_.find(id);
+      if (cache_it != spectrum_cache_.end())
       {
-        std::vector<OpenSwath::SpectrumPtr> all_spectra;
-        // always add the spectrum 0, then add those right and left
-        all_spectra.push_back(swath_map->getSpectrumById(closest_idx));
-        for (int i = 1; i <= nr_spectra_to_add / 2; i++) // cast to int is intended!
+        return cache_it->second;
+      }
+
+      if (spectrum_cache_.size() >= spectrum_cache_size_)
+      {
+        // the map is sorted by index, so the farthest spectrum is the first or the last one
+        if (id - spectrum_cache_.begin()->first > spectrum_cache_.rbegin()->first - id)
         {
-          all_spectra.push_back(swath_map->getSpectrumById(closest_idx - i));
-          all_spectra.push_back(swath_map->getSpectrumById(closest_idx + i));
+          spectrum_cache_.erase(spectrum_cache_.begin());
+        }
+        else
+        {
+          spectrum_cache_.erase(--spectrum_cache_.end());
         }
-        OpenSwath::SpectrumPtr spectrum_ = SpectrumAddition::addUpSpectra(all_spectra, spacing_for_spectra_resampling_, true);
-        return spectrum_;
       }
+
+      OpenSwath::SpectrumPtr spectrum = swath_map->getSpectrumById(id);
+      spectrum_cache_[id] = spectrum;
+      return spectrum;
     }
 
   };
@@ -620,6 +698,18 @@ var_yseries_score   -0.0327896378737766
   score those MRMFeatures using different criteria described in the
   MRMScoring class.
 
+  If OpenMP is enabled, the transition groups of one run are picked and scored
+  in parallel. Each thread uses its own picker and scoring objects and the
+  features are reported in the order of the transition groups, so the output
+  does not depend on the number of threads. The spectrum access objects
+  (chromatograms and SWATH maps) are only read, concurrently.
+
+  For the DIA scores, the SWATH spectra around a peak group are only added up
+  inside the m/z windows the scores look at (see
+  DIAScoring::getScoringWindows), and recently read SWATH spectra are kept,
+  so peak groups close in RT do not read them again. The transition groups
+  are processed in the order of their library retention time for this.
+
   @htmlinclude OpenMS_MRMFeatureFinderScoring.parameters
 
   */
@@ -678,6 +768,12 @@ public:
     }
 
     /** @brief Pick features in one experiment containing chromatogram
+     *
+     * The transition groups are picked and scored in parallel. If picking or
+     * scoring fails for a group, the remaining groups are still processed
+     * and the error of the first failing group is thrown afterwards.
+     *
+     * @exception Exception::BaseException is thrown if a transition group cannot be picked or scored (with name, location and message of the original error)
     */
     void pickExperiment(OpenSwath::SpectrumAccessPtr input, FeatureMap<Feature>& output, OpenSwath::LightTargetedExperiment& transition_exp,
                         TransformationDescription trafo, OpenSwath::SpectrumAccessPtr swath_map, TransitionGroupMapType& transition_group_map)
@@ -722,26 +818,112 @@ public:
       // Step 3
       //
       // Go through all transition groups: first create consensus features, then score them
-      Size progress = 0;
-      startProgress(0, transition_group_map.size(), "picking peaks");
+      std::vector<MRMTransitionGroupType*> transition_groups;
+      transition_groups.reserve(transition_group_map.size());
       for (TransitionGroupMapType::iterator trgroup_it = transition_group_map.begin(); trgroup_it != transition_group_map.end(); trgroup_it++)
       {
-
-        setProgress(++progress);
-        MRMTransitionGroupType& transition_group = trgroup_it->second;
-        if (transition_group.getChromatograms().size() == 0 || transition_group.getTransitions().size() == 0)
+        if (trgroup_it->second.getChromatograms().size() > 0 && trgroup_it->second.getTransitions().size() > 0)
         {
-          continue;
+          transition_groups.push_back(&trgroup_it->second);
         }
+      }
+
+      // indices of the scored features of each transition group
+      std::vector<std::vector<Size> > scored_features(transition_groups.size());
+
+      // process the groups by (library) retention time, so that the groups
+      // handled by one thread use the same SWATH spectra
+      std::vector<std::pair<double, Size> > processing_order;
+      processing_order.reserve(transition_groups.size());
+      for (Size i = 0; i < transition_groups.size(); ++i)
+      {
+        std::map<OpenMS::String, const PeptideType*>::const_iterator pep_it = PeptideRefMap_.find(transition_groups[i]->getTransitionGroupID());
+        processing_order.push_back(std::make_pair(pep_it != PeptideRefMap_.end() ? pep_it->second->rt : 0.0, i));
+      }
+      std::sort(processing_order.begin(), processing_order.end());
+
+      // set up the residue database before the threads use it
+      ResidueDB::getInstance();
+
+      // exceptions must not leave the parallel region; the error of the
+      // first failing group (in processing order) is thrown afterwards
+      SignedSize error_index = -1;
+      Exception::BaseException pick_error;
 
+      Size progress = 0;
+      startProgress(0, transition_groups.size(), "picking peaks");
+#ifdef _OPENMP
+#pragma omp parallel if (transition_groups.size() > 10)
+#endif
+      {
+        // thread-local picker and scoring objects
         MRMTransitionGroupPicker trgroup_picker;
         trgroup_picker.setParameters(param_.copy("TransitionGroupPicker:", true));
-        trgroup_picker.pickTransitionGroup(transition_group);
-        scorePeakgroups(trgroup_it->second, trafo, swath_map, output);
+        DIAScoring diascoring;
+        diascoring.setParameters(param_.copy("DIAScoring:", true));
+        EmgScoring emgscoring;
+        emgscoring.setFitterParam(param_.copy("EmgScoring:", true));
+        TransformationDescription local_trafo(trafo);
+        ChromatographicScorer scorer;
+        scorer.initialize(rt_normalization_factor_, add_up_spectra_, spacing_for_spectra_resampling_, su_);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 10)
+#endif
+        for (SignedSize k = 0; k < (SignedSize)processing_order.size(); ++k)
+        {
+          Size i = processing_order[k].second;
+          MRMTransitionGroupType& transition_group = *transition_groups[i];
+          bool failed = false;
+          Exception::BaseException error;
+          try
+          {
+            trgroup_picker.pickTransitionGroup(transition_group);
+            scorePeakgroups_(transition_group, local_trafo, swath_map, scorer, diascoring, emgscoring, scored_features[i]);
+          }
+          catch (Exception::BaseException & e)
+          {
+            failed = true;
+            error = e;
+          }
+          catch (std::exception & e)
+          {
+            failed = true;
+            error = Exception::BaseException(__FILE__, __LINE__, __PRETTY_FUNCTION__, "std::exception", e.what());
+          }
+          if (failed)
+          {
+#ifdef _OPENMP
+#pragma omp critical (MRMFeatureFinderScoring_error)
+#endif
+            {
+              if (error_index < 0 || k < error_index)
+              {
+                error_index = k;
+                pick_error = error;
+              }
+            }
+          }
 
+#ifdef _OPENMP
+#pragma omp critical (MRMFeatureFinderScoring_progress)
+#endif
+          setProgress(++progress);
+        }
       }
       endProgress();
 
+      if (error_index >= 0)
+      {
+        throw pick_error;
+      }
+
+      // report the features in the order of the transition groups
+      for (Size i = 0; i < transition_groups.size(); ++i)
+      {
+        reportPeakgroups_(*transition_groups[i], scored_features[i], output);
+      }
+
       //output.sortByPosition(); // if the exact same order is needed
       return;
     }
@@ -772,10 +954,48 @@ public:
     */
     void scorePeakgroups(MRMTransitionGroupType& transition_group, TransformationDescription & trafo,
                          OpenSwath::SpectrumAccessPtr swath_map, FeatureMap<Feature>& output)
+    {
+      ChromatographicScorer scorer;
+      scorer.initialize(rt_normalization_factor_, add_up_spectra_, spacing_for_spectra_resampling_, su_);
+
+      std::vector<Size> scored_features;
+      scorePeakgroups_(transition_group, trafo, swath_map, scorer, diascoring_, emgscoring_, scored_features);
+      reportPeakgroups_(transition_group, scored_features, output);
+    }
+
+    /** @brief Set the flag for strict mapping
+    */
+    void setStrictFlag(bool f)
+    {
+      strict_ = f;
+    }
+
+    /** @brief Map the chromatograms to the transitions.
+     *
+     * Map an input experiment (mzML) and transition list (TraML) onto each other
+     * when they share identifiers, e.g. if the transition id is the same as the
+     * chromatogram native id.
+    */
+    void mapExperimentToTransitionList(OpenSwath::SpectrumAccessPtr input, OpenSwath::LightTargetedExperiment& transition_exp,
+                                       TransitionGroupMapType& transition_group_map, TransformationDescription trafo, double rt_extraction_window);
+
+protected:
+
+    /** @brief Score all peak groups of a transition group (without reporting them)
+     *
+     * The scores are stored in the features of the transition group, the
+     * indices of the scored features are returned in @p scored_features.
+     * Only the transition group and the given scoring objects are modified,
+     * so different transition groups can be scored concurrently. The scorer
+     * has to be initialized with the parameters of this object.
+    */
+    void scorePeakgroups_(MRMTransitionGroupType& transition_group, TransformationDescription & trafo,
+                          OpenSwath::SpectrumAccessPtr swath_map, ChromatographicScorer & scorer, OpenMS::DIAScoring & diascoring,
+                          OpenMS::EmgScoring & emgscoring, std::vector<Size>& scored_features) const
     {
       typedef MRMTransitionGroupType::PeakType PeakT;
       std::vector<OpenSwath::ISignalToNoisePtr> signal_noise_estimators;
-      std::vector<MRMFeature> feature_list;
+      scored_features.clear();
 
       DoubleReal sn_win_len_ = (DoubleReal)param_.getValue("TransitionGroupPicker:PeakPickerMRM:sn_win_len");
       DoubleReal sn_bin_count_ = (DoubleReal)param_.getValue("TransitionGroupPicker:PeakPickerMRM:sn_bin_count");
@@ -785,11 +1005,21 @@ public:
         signal_noise_estimators.push_back(snptr);
       }
 
-      const PeptideType* pep = PeptideRefMap_[transition_group.getTransitionGroupID()];
+      std::map<OpenMS::String, const PeptideType*>::const_iterator pep_it = PeptideRefMap_.find(transition_group.getTransitionGroupID());
+      if (pep_it == PeptideRefMap_.end())
+      {
+        throw Exception::IllegalArgument(__FILE__, __LINE__, __PRETTY_FUNCTION__,
+          "Error: Transition group " + transition_group.getTransitionGroupID() + " has no peptide.");
+      }
+      const PeptideType* pep = pep_it->second;
       String protein_id = "";
       if (!pep->protein_ref.empty())
       {
-        protein_id = ProteinRefMap_[pep->protein_ref]->id;
+        std::map<OpenMS::String, const ProteinType*>::const_iterator prot_it = ProteinRefMap_.find(pep->protein_ref);
+        if (prot_it != ProteinRefMap_.end())
+        {
+          protein_id = prot_it->second->id;
+        }
       }
 
       // get the expected rt value for this peptide
@@ -798,18 +1028,16 @@ public:
       newtr.invert();
       expected_rt = newtr.apply(expected_rt);
 
-      ChromatographicScorer scorer;
-      scorer.initialize(rt_normalization_factor_, add_up_spectra_, spacing_for_spectra_resampling_, su_);
-
       // Go through all peak groups (found MRM features) and score them
       for (std::vector<MRMFeature>::iterator mrmfeature = transition_group.getFeaturesMuteable().begin();
            mrmfeature != transition_group.getFeaturesMuteable().end(); mrmfeature++)
       {
+        Size feature_index = mrmfeature - transition_group.getFeaturesMuteable().begin();
         OpenSwath::IMRMFeature* imrmfeature;
         imrmfeature = new MRMFeatureOpenMS(*mrmfeature);
 
         LOG_DEBUG << "scoring feature " << (*mrmfeature) << " == " << mrmfeature->getMetaValue("PeptideRef") <<
-        " [ expected RT " << PeptideRefMap_[mrmfeature->getMetaValue("PeptideRef")]->rt << " / " << expected_rt << " ]" <<
+        " [ expected RT " << pep->rt << " / " << expected_rt << " ]" <<
         " with " << transition_group.size()  << " nr transitions and nr chromats " << transition_group.getChromatograms().size() << std::endl;
 
         int group_size = boost::numeric_cast<int>(transition_group.size());
@@ -845,7 +1073,7 @@ public:
         if (swath_map->getNrSpectra() > 0)
         {
           scorer.calculateDIAScores(imrmfeature, transition_group.getTransitions(),
-              swath_map, diascoring_, *pep, scores);
+              swath_map, diascoring, *pep, scores);
         }
 
 
@@ -876,7 +1104,7 @@ public:
         if (su_.use_sn_score_) { mrmfeature->addScore("sn_ratio", scores.sn_ratio); mrmfeature->addScore("var_log_sn_score", scores.log_sn_score); }
         // TODO get it working with imrmfeature
         if (su_.use_elution_model_score_) { 
-          scores.elution_model_fit_score = emgscoring_.calcElutionFitScore((*mrmfeature), transition_group);
+          scores.elution_model_fit_score = emgscoring.calcElutionFitScore((*mrmfeature), transition_group);
           mrmfeature->addScore("var_elution_model_fit_score", scores.elution_model_fit_score); }
 
         double xx_lda_prescore = -scores.calculate_lda_prescore(scores);
@@ -929,14 +1157,12 @@ public:
         pep_id_.setIdentifier(run_identifier);
 
         mrmfeature->getPeptideIdentifications().push_back(pep_id_);
-        mrmfeature->ensureUniqueId();
         mrmfeature->setMetaValue("PrecursorMZ", transition_group.getTransitions()[0].getPrecursorMZ());
         mrmfeature->setSubordinates(mrmfeature->getFeatures()); // add all the subfeatures as subordinates
         double total_intensity = 0, total_peak_apices = 0;
         for (std::vector<Feature>::iterator sub_it = mrmfeature->getSubordinates().begin(); sub_it != mrmfeature->getSubordinates().end(); sub_it++)
         {
           if (!write_convex_hull_) {sub_it->getConvexHulls().clear(); }
-          sub_it->ensureUniqueId();
           if (sub_it->getMZ() > quantification_cutoff_)
           {
             total_intensity += sub_it->getIntensity();
@@ -946,10 +1172,32 @@ public:
         // overwrite the reported intensities with those above the m/z cutoff
         mrmfeature->setIntensity(total_intensity);
         mrmfeature->setMetaValue("peak_apices_sum", total_peak_apices);
-        feature_list.push_back((*mrmfeature));
+        scored_features.push_back(feature_index);
 
         delete imrmfeature;
       }
+    }
+
+    /** @brief Assigns unique ids to the scored features of a transition group and adds the best ones to @p output
+     *
+     * The unique ids are drawn sequentially (in the order of the features), so
+     * the ids do not depend on the order in which the groups were scored.
+    */
+    void reportPeakgroups_(MRMTransitionGroupType& transition_group, const std::vector<Size>& scored_features, FeatureMap<Feature>& output) const
+    {
+      std::vector<MRMFeature> feature_list;
+      feature_list.reserve(scored_features.size());
+
+      for (Size i = 0; i < scored_features.size(); i++)
+      {
+        MRMFeature& mrmfeature = transition_group.getFeaturesMuteable()[scored_features[i]];
+        mrmfeature.ensureUniqueId();
+        for (std::vector<Feature>::iterator sub_it = mrmfeature.getSubordinates().begin(); sub_it != mrmfeature.getSubordinates().end(); sub_it++)
+        {
+          sub_it->ensureUniqueId();
+        }
+        feature_list.push_back(mrmfeature);
+      }
 
       // Order by quality
       std::sort(feature_list.begin(), feature_list.end(), OpenMS::Feature::OverallQualityLess());
@@ -962,21 +1210,6 @@ public:
       }
     }
 
-    /** @brief Set the flag for strict mapping
-    */
-    void setStrictFlag(bool f)
-    {
-      strict_ = f;
-    }
-
-    /** @brief Map the chromatograms to the transitions.
-     *
-     * Map an input experiment (mzML) and transition list (TraML) onto each other
-     * when they share identifiers, e.g. if the transition id is the same as the
-     * chromatogram native id.
-    */
-    void mapExperimentToTransitionList(OpenSwath::SpectrumAccessPtr input, OpenSwath::LightTargetedExperiment& transition_exp,
-                                       TransitionGroupMapType& transition_group_map, TransformationDescription trafo, double rt_extraction_window);
 private:
 
     /// Synchronize members with param class
@@ -42,6 +42,9 @@
 
 #include <OpenMS/ANALYSIS/OPENSWATH/DATAACCESS/DataAccessHelper.h>
 
+#include <vector>
+#include <utility>
+
 namespace OpenMS
 {
   /**
@@ -56,6 +59,19 @@ public:
     /// adds up a list of Spectra by resampling them and then addition of intensities
     static OpenSwath::SpectrumPtr addUpSpectra(std::vector<OpenSwath::SpectrumPtr> all_spectra, double sampling_rate, double filter_zeros);
 
+    /**
+      @brief adds up a list of Spectra, but only inside the given m/z windows
+
+      The spectra are resampled on the same grid as in the function above and
+      the returned points carry exactly the same intensities, but only grid
+      points inside one of the windows (given as pairs of start and end m/z)
+      are computed and returned. Only the peaks near the windows are read.
+      This is much cheaper if the sum is only inspected at a few places (e.g.
+      around the fragment ions of a peptide).
+    */
+    static OpenSwath::SpectrumPtr addUpSpectra(std::vector<OpenSwath::SpectrumPtr> all_spectra, const std::vector<std::pair<double, double> >& mz_windows,
+                                               double sampling_rate, bool filter_zeros);
+
   };
 }
 
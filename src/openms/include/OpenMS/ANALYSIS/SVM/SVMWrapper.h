@@ -340,6 +340,9 @@ public:
     /**
       @brief Performs a CV for the data given by 'problem'
 
+      The grid cells are trained and evaluated in parallel (with OpenMP); the result does not depend on the number of threads.
+      For the oligo kernel, the kernel values of all pairs of samples are kept in memory (n * (n + 1) / 2 doubles, i.e. about
+      400 MB for 10000 samples). For more samples, the kernel matrices are computed for every partition instead.
     */
     DoubleReal performCrossValidation(svm_problem * problem_ul,
                                       const SVMData & problem_l,
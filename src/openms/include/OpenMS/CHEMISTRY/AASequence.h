@@ -42,6 +42,8 @@
 #include <OpenMS/CHEMISTRY/Residue.h>
 #include <OpenMS/CHEMISTRY/ResidueModification.h>
 
+#include <boost/shared_ptr.hpp>
+
 #include <vector>
 #include <iostream>
 
@@ -79,6 +81,13 @@ namespace OpenMS
       can be read using the isValid() predicate. However, instances of AASequence which are not valid report
       wrong weights, because the weight cannot be calculated then. Also other operations might fail.
 
+      Copies of a sequence share their residues (copy on write), so identical sequences stored in many
+      places (e.g. the peptide hits of a large identification run) need the memory only once. Sequences
+      constructed from strings are taken from a parse cache: every distinct string is parsed once, and
+      its formula and full mono and average weight are computed once and shared by all sequences built
+      from it. The cache is thread-safe and is cleared when it grows too large or the ResidueDB changes
+      (see clearParseCache()).
+
       @ingroup Chemistry
   */
   class OPENMS_DLLAPI AASequence
@@ -550,13 +559,14 @@ protected:
     /** @name Iterators
     */
     //@{
-    inline Iterator begin() { return Iterator(&peptide_, 0); }
+    // the iterators cannot modify residues, so they may point into shared data
+    inline Iterator begin() { return Iterator(&data_->residues, 0); }
 
-    inline ConstIterator begin() const { return ConstIterator(&peptide_, 0); }
+    inline ConstIterator begin() const { return ConstIterator(&data_->residues, 0); }
 
-    inline Iterator end() { return Iterator(&peptide_, (Int) peptide_.size()); }
+    inline Iterator end() { return Iterator(&data_->residues, (Int) data_->residues.size()); }
 
-    inline ConstIterator end() const { return ConstIterator(&peptide_, (Int) peptide_.size()); }
+    inline ConstIterator end() const { return ConstIterator(&data_->residues, (Int) data_->residues.size()); }
     //@}
 
     /** @name Stream operators
@@ -569,12 +579,42 @@ protected:
     friend OPENMS_DLLAPI std::istream & operator>>(std::istream & is, const AASequence & peptide);
     //@}
 
+    /// removes all sequences from the parse cache (needed if residues of the ResidueDB are replaced)
+    static void clearParseCache();
+
 protected:
 
-    std::vector<const Residue *> peptide_;
+    /// Residues and values derived from them, shared between copies of a sequence
+    struct Data_
+    {
+      Data_();
+
+      std::vector<const Residue *> residues;
+
+      /// true if the members below hold the full formula and weights (charge 0) of the sequence
+      bool has_weights;
+
+      EmpiricalFormula formula;
+
+      DoubleReal mono_weight;
+
+      DoubleReal average_weight;
+    };
+
+    /// shared residues; only modified through mutableResidues_()
+    boost::shared_ptr<Data_> data_;
 
     String sequence_string_;
 
+    /// returns the data shared by all empty sequences
+    static const boost::shared_ptr<Data_> & emptyData_();
+
+    /// returns the residues for modification, after making a private copy if they are shared
+    std::vector<const Residue *> & mutableResidues_();
+
+    /// sets the sequence from @p peptide, using the parse cache
+    void parseCached_(const String & peptide);
+
     void parseString_(std::vector<const Residue *> & sequence, const String & peptide);
 
     ResidueDB * getResidueDB_() const;
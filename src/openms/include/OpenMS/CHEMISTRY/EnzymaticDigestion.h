@@ -143,6 +143,14 @@ public:
     /// Returns true if peptide at position @p pep_pos with length @p pep_length within protein @p protein was generated by the current model
     bool isValidProduct(const AASequence& protein, Size pep_pos, Size pep_length);
 
+    /**
+      @brief Returns true if peptide at position @p pep_pos with length @p pep_length within protein @p protein was generated by the current model
+
+      Same as above, but for an unmodified protein sequence given in one-letter code. This avoids
+      constructing an AASequence (i.e. parsing the whole protein) for each test and is thread-safe.
+    */
+    bool isValidProduct(const String& protein, Size pep_pos, Size pep_length) const;
+
 protected:
     // define a binding site by position and AA
     struct BindingSite
@@ -186,6 +194,9 @@ protected:
     /// tests if position pointed to by @p p (N-term side) is a valid cleavage site
     bool isCleavageSite_(const AASequence & sequence, const AASequence::ConstIterator & p) const;
 
+    /// tests if position @p pos (N-term side) of the unmodified one-letter @p sequence is a valid cleavage site
+    bool isCleavageSite_(const String & sequence, Size pos) const;
+
     /// Number of missed cleavages
     SignedSize missed_cleavages_;
     /// Used enzyme
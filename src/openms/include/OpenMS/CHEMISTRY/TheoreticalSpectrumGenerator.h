@@ -39,6 +39,8 @@
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
 #include <OpenMS/KERNEL/StandardTypes.h>
 
+#include <vector>
+
 namespace OpenMS
 {
   class AASequence;
@@ -46,6 +48,15 @@ namespace OpenMS
   /**
       @brief Generates theoretical spectra with various options
 
+      The masses of the prefix and suffix ions are computed from the cumulative
+      residue masses of the peptide, which are determined only once per peptide.
+      Only if isotope or neutral loss peaks are requested, the ions are built as
+      sub-sequences of the peptide (which is considerably slower).
+
+      If no peak annotations are needed, use the PeakSpectrum variant of
+      getSpectrum(), which does not create meta data for the peaks. getSpectra()
+      generates the spectra of many peptides in parallel.
+
   @htmlinclude OpenMS_TheoreticalSpectrumGenerator.parameters
 
       @ingroup Chemistry
@@ -77,6 +88,23 @@ public:
     /// returns a spectrum with b and y peaks
     virtual void getSpectrum(RichPeakSpectrum & spec, const AASequence & peptide, Int charge = 1);
 
+    /**
+      @brief returns a spectrum with b and y peaks, without annotations
+
+      The same parameters as for the RichPeakSpectrum variant apply, except for "add_metainfo", which is ignored.
+    */
+    void getSpectrum(PeakSpectrum & spec, const AASequence & peptide, Int charge = 1);
+
+    /**
+      @brief generates the spectra of @p peptides in parallel
+
+      The spectrum at position i of @p spectra belongs to the peptide at position i of @p peptides.
+    */
+    void getSpectra(std::vector<RichPeakSpectrum> & spectra, const std::vector<AASequence> & peptides, Int charge = 1) const;
+
+    /// generates the spectra of @p peptides in parallel, without annotations
+    void getSpectra(std::vector<PeakSpectrum> & spectra, const std::vector<AASequence> & peptides, Int charge = 1) const;
+
     /// adds peaks to a spectrum of the given ion-type, peptide, charge, and intensity
     virtual void addPeaks(RichPeakSpectrum & spectrum, const AASequence & peptide, Residue::ResidueType res_type, Int charge = 1);
 
@@ -88,7 +116,51 @@ public:
     //@}
 
 protected:
+    /// computes the cumulative masses of the residues of @p peptide (@p prefix_masses[i] is the mass of the first i residues)
+    static void getPrefixMasses_(const AASequence & peptide, std::vector<DoubleReal> & prefix_masses);
+
+    /// computes the uncharged masses of the ions of type @p res_type, ordered by the number of residues (starting with one residue)
+    void getIonMasses_(std::vector<DoubleReal> & masses, const AASequence & peptide, const std::vector<DoubleReal> & prefix_masses, Residue::ResidueType res_type) const;
+
+    /// returns the intensity and the name prefix ("a", "b", ...) of ions of type @p res_type
+    bool getIonType_(Residue::ResidueType res_type, DoubleReal & intensity, String & name) const;
+
+    /// adds the ion ladders of all requested ion types and charges (no isotopes and losses)
+    template <typename SpectrumType>
+    void addIonLadders_(SpectrumType & spectrum, const AASequence & peptide, Int charge);
+
+    /// adds the peaks of the ions with the uncharged masses @p masses at charge @p charge
+    void addIonPeaks_(RichPeakSpectrum & spectrum, const std::vector<DoubleReal> & masses, Residue::ResidueType res_type, Int charge);
+
+    /// adds the peaks of the ions with the uncharged masses @p masses at charge @p charge (without annotations)
+    void addIonPeaks_(PeakSpectrum & spectrum, const std::vector<DoubleReal> & masses, Residue::ResidueType res_type, Int charge) const;
+
+    // docu in base class
+    void updateMembers_();
+
     RichPeak1D p_;
+
+    /// @name Parameters (see updateMembers_())
+    //@{
+    bool add_b_ions_;
+    bool add_y_ions_;
+    bool add_a_ions_;
+    bool add_c_ions_;
+    bool add_x_ions_;
+    bool add_z_ions_;
+    bool add_first_prefix_ion_;
+    bool add_metainfo_;
+    bool add_isotopes_;
+    bool add_losses_;
+    bool add_precursor_peaks_;
+    bool add_abundant_immonium_ions_;
+    DoubleReal a_intensity_;
+    DoubleReal b_intensity_;
+    DoubleReal c_intensity_;
+    DoubleReal x_intensity_;
+    DoubleReal y_intensity_;
+    DoubleReal z_intensity_;
+    //@}
   };
 }
 
@@ -50,6 +50,12 @@ namespace OpenMS
       The details of the method can be found in:
       Backhaus, Erichson, Plinke, Weiber Multivariate Analysemethoden, Springer 2000 and
       Ellen M. Voorhees: Implementing agglomerative hierarchic clustering algorithms for use in document retrieval. Inf. Process. Manage. 22(6): 465-476 (1986)
+
+      The clustering is computed with the nearest-neighbor chain algorithm in O(n^2) time, see
+      Daniel Muellner: Modern hierarchical, agglomerative clustering algorithms. arXiv:1109.2378 (2011)
+
+      Sparse input (see ClusterFunctor::clusterSparse()) is not supported: the average distance of two clusters depends on all their pairs,
+      so it cannot be computed from the close pairs only.
       @see ClusterFunctor
 
       @ingroup SpectraClustering
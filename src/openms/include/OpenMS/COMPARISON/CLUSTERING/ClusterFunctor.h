@@ -38,6 +38,7 @@
 #include <OpenMS/DATASTRUCTURES/DistanceMatrix.h>
 #include <OpenMS/CONCEPT/Exception.h>
 #include <OpenMS/COMPARISON/CLUSTERING/ClusterAnalyzer.h>
+#include <OpenMS/CONCEPT/ProgressLogger.h>
 
 #include <vector>
 
@@ -49,6 +50,9 @@ namespace OpenMS
 
       Each cluster functor employs a different method for stepwise merging clusters up to a given threshold, starting from the most elementary partition of data. Elements are represented by indices of a given distance matrix, which also should represent the order of input.
 
+      Besides the distance matrix, single and complete linkage accept a sparse list of distances (see clusterSparse()) for clusterings
+      with a threshold, where only the distances below the threshold are known or of interest.
+
       @ingroup SpectraClustering
   */
   class OPENMS_DLLAPI ClusterFunctor
@@ -71,6 +75,23 @@ public:
     };
 
 
+    /// Distance between two elements, used as sparse input of clusterSparse()
+    struct SparseDistance
+    {
+      /// index of the first element
+      Size first;
+      /// index of the second element
+      Size second;
+      /// distance of the elements
+      Real distance;
+
+      /// constructor
+      SparseDistance(Size f = 0, Size s = 0, Real d = 0) :
+        first(f), second(s), distance(d)
+      {
+      }
+    };
+
     /// default constructor
     ClusterFunctor();
 
@@ -97,9 +118,78 @@ public:
     */
     virtual void operator()(DistanceMatrix<Real> & original_distance, std::vector<BinaryTreeNode> & cluster_tree, const Real threshold = 1) const = 0;
 
+    /**
+        @brief clusters @p size elements of which only the distances in @p distances are known
+
+        All pairs of elements not contained in @p distances are considered to be at least @p threshold apart, so this variant is meant
+        for clusterings with a threshold of which only the close pairs are computed (e.g. by a range search). The result has the same format
+        as the one of operator(), i.e. after the last merge below @p threshold, @p cluster_tree is filled with dummy nodes (distance -1).
+        If a pair is contained more than once, its smallest distance is used.
+
+        @param size number of elements to be clustered
+        @param distances the known distances, entries not below @p threshold are ignored
+        @param cluster_tree vector< BinaryTreeNode >, represents the clustering (see operator())
+        @param threshold Real value, the minimal distance from which on cluster merging is considered unrealistic
+
+        @throw ClusterFunctor::InsufficientInput thrown if @p size is <2
+        @throw Exception::IndexOverflow thrown if an element index in @p distances is not below @p size
+        @throw Exception::NotImplemented thrown if the derived class does not support sparse input (the default)
+    */
+    virtual void clusterSparse(Size size, const std::vector<SparseDistance> & distances, std::vector<BinaryTreeNode> & cluster_tree, const Real threshold = 1) const;
+
     /// registers all derived products
     static void registerChildren();
 
+protected:
+
+    /**
+        @brief Lance-Williams type update of the distance of a cluster k to the union of the clusters i and j
+
+        @param d_ik distance of the clusters i and k
+        @param d_jk distance of the clusters j and k
+        @param n_i number of elements in cluster i
+        @param n_j number of elements in cluster j
+    */
+    typedef Real (* DistanceUpdate_)(Real d_ik, Real d_jk, Size n_i, Size n_j);
+
+    /// A merge found by the nearest-neighbor chain, with the merges it depends on
+    struct Merge_
+    {
+      /// cluster (i.e. its smallest element) that remains
+      Size keep;
+      /// cluster (i.e. its smallest element) that is merged into @p keep
+      Size drop;
+      /// distance of the clusters
+      Real distance;
+      /// indices of the merges that formed the two clusters (std::numeric_limits<Size>::max() for single elements)
+      Size after_keep;
+      Size after_drop;
+    };
+
+    /**
+        @brief Clusters a distance matrix with the nearest-neighbor chain algorithm
+
+        This is the common part of the linkages whose distance update is "reducible" (single, complete and average linkage): a merge never
+        brings a cluster closer to a third one than both merged clusters were. Then every pair of reciprocal nearest neighbors can be merged
+        right away and the clustering needs O(n^2) time, while searching the closest pair after each merge takes O(n^3).
+        The merges are reported in the order the classic agglomerative algorithm would perform them (ascending distance, ties resolved by the
+        smaller indices), see buildTree_().
+
+        @p original_distance is changed: the distances of a merged cluster are stored at the smaller index of the two.
+    */
+    static void nearestNeighborChain_(DistanceMatrix<Real> & original_distance, std::vector<BinaryTreeNode> & cluster_tree, const Real threshold, DistanceUpdate_ update, const ProgressLogger & logger);
+
+    /// Sparse version of nearestNeighborChain_(), missing distances are taken as @p threshold
+    static void sparseNearestNeighborChain_(Size size, const std::vector<SparseDistance> & distances, std::vector<BinaryTreeNode> & cluster_tree, const Real threshold, DistanceUpdate_ update, const ProgressLogger & logger);
+
+    /**
+        @brief Converts the merges of @p size elements into a cluster tree
+
+        Merges are taken in ascending order of distance as long as the merges they depend on are done, up to @p threshold.
+        The remaining clusters are connected by dummy nodes (distance -1).
+    */
+    static void buildTree_(Size size, const std::vector<Merge_> & merges, const Real threshold, std::vector<BinaryTreeNode> & cluster_tree);
+
   };
 
 }
@@ -50,6 +50,8 @@
 #include <OpenMS/COMPARISON/SPECTRA/BinnedSpectrumCompareFunctor.h>
 #include <OpenMS/CONCEPT/Exception.h>
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 namespace OpenMS
@@ -59,6 +61,10 @@ namespace OpenMS
       @brief Hierarchical clustering with generic clustering functions
 
       ClusterHierarchical clusters objects with corresponding distancemethod and clusteringmethod.
+
+      The distance matrix is computed in square tiles of pairs, so that the objects compared together stay in the cache. If enabled with
+      setParallel(), the tiles are distributed over several threads (with OpenMP). This is off by default, because many similarity functors
+      (e.g. SpectrumCheapDPCorr) keep state between calls; only enable it if the functor is safe to call from several threads at once.
       @ingroup SpectraClustering
   */
   class OPENMS_DLLAPI ClusterHierarchical
@@ -68,16 +74,56 @@ private:
     /// the threshold given to the ClusterFunctor
     double threshold_;
 
+    /// compute the distance matrix with several threads?
+    bool parallel_;
+
+    /// Fills @p distance with 1 - similarity of all pairs of @p data, in parallel if enabled
+    template <typename Data, typename SimilarityComparator>
+    void computeDistances_(const std::vector<Data> & data, const SimilarityComparator & comparator, DistanceMatrix<Real> & distance) const
+    {
+      distance.clear();
+      distance.resize(data.size(), 1);
+
+      // the lower triangle of the matrix in tiles of tile_size x tile_size pairs, tile (r, c) with c <= r has the index r * (r + 1) / 2 + c
+      const SignedSize tile_size = 64;
+      const SignedSize tiles = ((SignedSize)data.size() + tile_size - 1) / tile_size;
+      const SignedSize tile_pairs = tiles * (tiles + 1) / 2;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) if (parallel_ && data.size() > 100)
+#endif
+      for (SignedSize t = 0; t < tile_pairs; ++t)
+      {
+        SignedSize r = (SignedSize)((std::sqrt(8.0 * t + 1.0) - 1.0) / 2.0);
+        while (r * (r + 1) / 2 > t) --r;
+        while ((r + 1) * (r + 2) / 2 <= t) ++r;
+        SignedSize c = t - r * (r + 1) / 2;
+
+        Size row_end = std::min((Size)((r + 1) * tile_size), data.size());
+        for (Size i = r * tile_size; i < row_end; ++i)
+        {
+          Size col_end = std::min((Size)((c + 1) * tile_size), i);
+          for (Size j = c * tile_size; j < col_end; ++j)
+          {
+            //distance value is 1-similarity value, since similarity is in range of [0,1]
+            distance.setValueQuick(i, j, 1 - comparator(data[i], data[j]));
+          }
+        }
+      }
+      distance.updateMinElement();
+    }
+
 public:
     /// default constructor
     ClusterHierarchical() :
-      threshold_(1.0)
+      threshold_(1.0),
+      parallel_(false)
     {
     }
 
     /// copy constructor
     ClusterHierarchical(const ClusterHierarchical & source) :
-      threshold_(source.threshold_)
+      threshold_(source.threshold_),
+      parallel_(source.parallel_)
     {
     }
 
@@ -110,16 +156,7 @@ public:
       if (original_distance.dimensionsize() != data.size())
       {
         //create distancematrix for data with comparator
-        original_distance.clear();
-        original_distance.resize(data.size(), 1);
-        for (Size i = 0; i < data.size(); i++)
-        {
-          for (Size j = 0; j < i; j++)
-          {
-            //distance value is 1-similarity value, since similarity is in range of [0,1]
-            original_distance.setValueQuick(i, j, 1 - comparator(data[i], data[j]));
-          }
-        }
+        computeDistances_(data, comparator, original_distance);
       }
 
       //~ std::cout << "done" << std::endl; //maybe progress handler?
@@ -157,17 +194,7 @@ public:
       }
 
       //create distancematrix for data with comparator
-      original_distance.clear();
-      original_distance.resize(data.size(), 1);
-
-      for (Size i = 0; i < binned_data.size(); i++)
-      {
-        for (Size j = 0; j < i; j++)
-        {
-          //distance value is 1-similarity value, since similarity is in range of [0,1]
-          original_distance.setValue(i, j, 1 - comparator(binned_data[i], binned_data[j]));
-        }
-      }
+      computeDistances_(binned_data, comparator, original_distance);
 
       // create Clustering with ClusterMethod, DistanceMatrix and Data
       clusterer(original_distance, cluster_tree, threshold_);
@@ -187,6 +214,19 @@ public:
       threshold_ = x;
     }
 
+    /// whether the distance matrix is computed with several threads
+    bool getParallel() const
+    {
+      return parallel_;
+    }
+
+    /// compute the distance matrix with several threads (if OpenMP is enabled)
+    /// The default is false. Only enable this if the similarity functor is safe to call from several threads at once.
+    void setParallel(bool parallel)
+    {
+      parallel_ = parallel;
+    }
+
   };
 
   /** @brief Exception thrown if clustering is attempted without a normalized compare functor
@@ -51,6 +51,9 @@ namespace OpenMS
       The details of the method can be found in:
       Backhaus, Erichson, Plinke, Weiber Multivariate Analysemethoden, Springer 2000 and
       Ellen M. Voorhees: Implementing agglomerative hierarchic clustering algorithms for use in document retrieval. Inf. Process. Manage. 22(6): 465-476 (1986)
+
+      The clustering is computed with the nearest-neighbor chain algorithm in O(n^2) time, see
+      Daniel Muellner: Modern hierarchical, agglomerative clustering algorithms. arXiv:1109.2378 (2011)
       @see ClusterFunctor
 
       @ingroup SpectraClustering
@@ -84,6 +87,15 @@ public:
     */
     void operator()(DistanceMatrix<Real> & original_distance, std::vector<BinaryTreeNode> & cluster_tree, const Real threshold = 1) const;
 
+    /**
+        @brief clusters @p size elements of which only the distances in @p distances are known
+
+        All other pairs are considered to be at least @p threshold apart. Since the maximum of the distances decides, clusters with a missing pair
+        are never merged and the result equals the one of the complete data.
+        @see ClusterFunctor::clusterSparse()
+    */
+    void clusterSparse(Size size, const std::vector<SparseDistance> & distances, std::vector<BinaryTreeNode> & cluster_tree, const Real threshold = 1) const;
+
     /// creates a new instance of a CompleteLinkage object
     static ClusterFunctor * create()
     {
@@ -51,6 +51,8 @@ namespace OpenMS
 
       The details of the method can be found in:
       SLINK: An optimally efficient algorithm for the single-link cluster method, The Computer Journal 1973 16(1):30-34; doi:10.1093/comjnl/16.1.30
+
+      Sparse input (see clusterSparse()) is clustered with the nearest-neighbor chain algorithm and supports a threshold.
       @see ClusterFunctor() base class.
 
       @ingroup SpectraClustering
@@ -84,6 +86,15 @@ public:
     */
     void operator()(DistanceMatrix<Real> & original_distance, std::vector<BinaryTreeNode> & cluster_tree, const Real threshold = 1) const;
 
+    /**
+        @brief clusters @p size elements of which only the distances in @p distances are known
+
+        All other pairs are considered to be at least @p threshold apart. Since the minimum of the distances decides, the result equals the one
+        of the complete data up to @p threshold.
+        @see ClusterFunctor::clusterSparse()
+    */
+    void clusterSparse(Size size, const std::vector<SparseDistance> & distances, std::vector<BinaryTreeNode> & cluster_tree, const Real threshold = 1) const;
+
     /// creates a new instance of a SingleLinkage object
     static ClusterFunctor * create()
     {
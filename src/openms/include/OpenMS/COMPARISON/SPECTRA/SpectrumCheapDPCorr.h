@@ -50,6 +50,9 @@ namespace OpenMS
     Peaks get a score depending on the difference in position and the heights of the peaks <br>
     pairs with positions that differ more than some limit get score 0
 
+    The comparison keeps the last consensus spectrum, so one instance must not be used by several threads at once
+    (e.g. by ClusterHierarchical with ClusterHierarchical::setParallel()).
+
     @htmlinclude OpenMS_SpectrumCheapDPCorr.parameters
 
     @ingroup SpectraComparison
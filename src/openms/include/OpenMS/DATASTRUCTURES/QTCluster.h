@@ -76,13 +76,31 @@ namespace OpenMS
 
   class OPENMS_DLLAPI QTCluster
   {
-private:
+public:
 
     /**
-     * @brief Mapping: input map -> distance to center (ordered!) -> neighboring point
-     * @note There should never be an empty sub-map! (When a sub-map becomes empty, it should be removed from the overall map.)
+     * @brief Neighbors from one input map: (distance to center, neighboring point), sorted by distance
+     *
+     * Points with equal distance are kept in insertion order.
      */
-    typedef OpenMSBoost::unordered_map<Size, std::multimap<DoubleReal, GridFeature *> > NeighborMap;
+    typedef std::vector<std::pair<DoubleReal, GridFeature *> > NeighborList;
+
+    /**
+     * @brief Mapping: input map -> neighbors sorted by distance to center
+     * @note There should never be an empty neighbor list! (When a list becomes empty, it should be removed from the overall map.)
+     */
+    typedef OpenMSBoost::unordered_map<Size, NeighborList> NeighborMap;
+
+private:
+
+    /// Comparator for neighbor list entries (by distance only)
+    struct DistanceLess_
+    {
+      inline bool operator()(const NeighborList::value_type & left, const NeighborList::value_type & right) const
+      {
+        return left.first < right.first;
+      }
+    };
 
     /// Pointer to the cluster center
     GridFeature * center_point_;
@@ -185,7 +203,8 @@ public:
 
     inline bool isInvalid() {return !valid_;}
 
-    NeighborMap getNeighbors() {return neighbors_;}
+    /// Returns the neighbors of the cluster center (sorted by distance, per input map)
+    inline const NeighborMap & getNeighbors() const {return neighbors_;}
 
   };
 }
@@ -60,7 +60,7 @@ public:
 
     /**
     @brief constructor
-    @param filename FASTA File name
+    @param filename FASTA File name (or a protein index created by FASTAIndexer, recognized by the extension '.fidx'. If the database the index was created from is found next to it (same name without '.fidx') and does not match the index any more, the database is read instead.)
     @param method Name of the method used (trypticCompressed, seqan, trypticSeqan)
     @param weight_mode if not monoistopic weight should be used, this parameters can be set to AVERAGE
     @throw FileNotFound is thrown if the filename is not found
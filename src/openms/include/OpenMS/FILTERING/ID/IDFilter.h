@@ -56,7 +56,9 @@ namespace OpenMS
     The filtering by sequences looks for the best ProteinIdentification that
     is contained in one of the protein sequences.
 
-    TODO: fix design of filter functions. There will be an error e.g. if input and output points to the same PeptideIdentification.
+    All filter functions may be called with @p identification and @p filtered_identification
+    referring to the same object, which filters the hits in place and avoids copying the
+    identification twice.
   */
   class OPENMS_DLLAPI IDFilter
   {
@@ -73,12 +75,8 @@ public:
     void filterIdentificationsByThreshold(const IdentificationType& identification, DoubleReal threshold_fraction, IdentificationType& filtered_identification)
     {
       typedef typename IdentificationType::HitType HitType;
-      std::vector<HitType> temp_hits;
       std::vector<HitType> filtered_hits;
 
-      filtered_identification = identification;
-      filtered_identification.setHits(std::vector<HitType>());
-
       for (typename std::vector<HitType>::const_iterator it = identification.getHits().begin();
            it != identification.getHits().end();
            ++it)
@@ -89,11 +87,7 @@ public:
         }
       }
 
-      if (!filtered_hits.empty())
-      {
-        filtered_identification.setHits(filtered_hits);
-        filtered_identification.assignRanks();
-      }
+      assignFilteredHits_(identification, filtered_hits, filtered_identification, true);
     }
 
     /**
@@ -107,12 +101,8 @@ public:
     void filterIdentificationsByScore(const IdentificationType& identification, DoubleReal threshold_score, IdentificationType& filtered_identification)
     {
       typedef typename IdentificationType::HitType HitType;
-      std::vector<HitType> temp_hits;
       std::vector<HitType> filtered_hits;
 
-      filtered_identification = identification;
-      filtered_identification.setHits(std::vector<HitType>());
-
       for (typename std::vector<HitType>::const_iterator it = identification.getHits().begin();
            it != identification.getHits().end();
            ++it)
@@ -133,11 +123,7 @@ public:
         }
       }
 
-      if (!filtered_hits.empty())
-      {
-        filtered_identification.setHits(filtered_hits);
-        filtered_identification.assignRanks();
-      }
+      assignFilteredHits_(identification, filtered_hits, filtered_identification, true);
     }
 
     /**
@@ -150,31 +136,21 @@ public:
     void filterIdentificationsByBestNHits(const IdentificationType& identification, Size n, IdentificationType& filtered_identification)
     {
       typedef typename IdentificationType::HitType HitType;
-      std::vector<HitType> temp_hits;
-      std::vector<HitType> filtered_hits;
-      Size count = 0;
-
-      IdentificationType temp_identification = identification;
-      temp_identification.sort(); // .. by score
-
-      filtered_identification = identification;
-      filtered_identification.setHits(std::vector<HitType>());
+      std::vector<HitType> filtered_hits(identification.getHits());
 
+      // sort the hits only (by score), not a copy of the whole identification
+      IdentificationType temp_identification;
+      temp_identification.setHigherScoreBetter(identification.isHigherScoreBetter());
+      temp_identification.getHits().swap(filtered_hits);
+      temp_identification.sort();
+      temp_identification.getHits().swap(filtered_hits);
 
-      typename std::vector<HitType>::const_iterator it = temp_identification.getHits().begin();
-      while (it != temp_identification.getHits().end()
-            && count < n)
+      if (filtered_hits.size() > n)
       {
-        filtered_hits.push_back(*it);
-        ++it;
-        ++count;
+        filtered_hits.erase(filtered_hits.begin() + n, filtered_hits.end());
       }
 
-      if (!filtered_hits.empty())
-      {
-        filtered_identification.setHits(filtered_hits);
-        filtered_identification.assignRanks();
-      }
+      assignFilteredHits_(identification, filtered_hits, filtered_identification, true);
     }
 
     /**
@@ -195,12 +171,11 @@ public:
       typedef typename IdentificationType::HitType HitType;
       std::vector<HitType> filtered_hits;
 
-      IdentificationType temp_identification = identification;
+      IdentificationType temp_identification;
+      temp_identification.setHigherScoreBetter(identification.isHigherScoreBetter());
+      temp_identification.setHits(identification.getHits());
       temp_identification.sort(); // .. by score
 
-      filtered_identification = identification;
-      filtered_identification.setHits(std::vector<HitType>());
-
       const std::vector<HitType>& hits = temp_identification.getHits();
       for (Size i = n - 1; n <= m - 1; ++i)
       {
@@ -211,11 +186,7 @@ public:
         filtered_hits.push_back(hits[i]);
       }
 
-      if (!filtered_hits.empty())
-      {
-        filtered_identification.setHits(filtered_hits);
-        filtered_identification.assignRanks();
-      }
+      assignFilteredHits_(identification, filtered_hits, filtered_identification, true);
     }
 
     /// filters a PeptideIdentification keeping only the best scoring hits (if strict is set, keeping only the best hit only if it is the only hit with that score)
@@ -290,35 +261,22 @@ public:
     void filterIdentificationsByThresholds(MSExperiment<PeakT>& experiment, DoubleReal peptide_threshold_fraction, DoubleReal protein_threshold_fraction)
     {
       //filter protein hits
-      ProteinIdentification temp_protein_identification;
-      std::vector<ProteinIdentification> filtered_protein_identifications;
-
-      for (Size j = 0; j < experiment.getProteinIdentifications().size(); j++)
+      std::vector<ProteinIdentification>& protein_identifications = experiment.getProteinIdentifications();
+      for (Size j = 0; j < protein_identifications.size(); j++)
       {
-        filterIdentificationsByThreshold(experiment.getProteinIdentifications()[j], protein_threshold_fraction, temp_protein_identification);
-        if (!temp_protein_identification.getHits().empty())
-        {
-          filtered_protein_identifications.push_back(temp_protein_identification);
-        }
+        filterIdentificationsByThreshold(protein_identifications[j], protein_threshold_fraction, protein_identifications[j]);
       }
-      experiment.setProteinIdentifications(filtered_protein_identifications);
+      removeEmptyIdentifications_(protein_identifications);
 
       //filter peptide hits
-      PeptideIdentification temp_identification;
-      std::vector<PeptideIdentification> filtered_identifications;
-
       for (Size i = 0; i < experiment.size(); i++)
       {
-        for (Size j = 0; j < experiment[i].getPeptideIdentifications().size(); j++)
+        std::vector<PeptideIdentification>& identifications = experiment[i].getPeptideIdentifications();
+        for (Size j = 0; j < identifications.size(); j++)
         {
-          filterIdentificationsByThreshold(experiment[i].getPeptideIdentifications()[j], peptide_threshold_fraction, temp_identification);
-          if (!temp_identification.getHits().empty())
-          {
-            filtered_identifications.push_back(temp_identification);
-          }
+          filterIdentificationsByThreshold(identifications[j], peptide_threshold_fraction, identifications[j]);
         }
-        experiment[i].setPeptideIdentifications(filtered_identifications);
-        filtered_identifications.clear();
+        removeEmptyIdentifications_(identifications);
       }
     }
 
@@ -327,35 +285,22 @@ public:
     void filterIdentificationsByScores(MSExperiment<PeakT>& experiment, DoubleReal peptide_threshold_score, DoubleReal protein_threshold_score)
     {
       //filter protein hits
-      ProteinIdentification temp_protein_identification;
-      std::vector<ProteinIdentification> filtered_protein_identifications;
-
-      for (Size j = 0; j < experiment.getProteinIdentifications().size(); j++)
+      std::vector<ProteinIdentification>& protein_identifications = experiment.getProteinIdentifications();
+      for (Size j = 0; j < protein_identifications.size(); j++)
       {
-        filterIdentificationsByScore(experiment.getProteinIdentifications()[j], protein_threshold_score, temp_protein_identification);
-        if (!temp_protein_identification.getHits().empty())
-        {
-          filtered_protein_identifications.push_back(temp_protein_identification);
-        }
+        filterIdentificationsByScore(protein_identifications[j], protein_threshold_score, protein_identifications[j]);
       }
-      experiment.setProteinIdentifications(filtered_protein_identifications);
+      removeEmptyIdentifications_(protein_identifications);
 
       //filter peptide hits
-      PeptideIdentification temp_identification;
-      std::vector<PeptideIdentification> filtered_identifications;
-
       for (Size i = 0; i < experiment.size(); i++)
       {
-        for (Size j = 0; j < experiment[i].getPeptideIdentifications().size(); j++)
+        std::vector<PeptideIdentification>& identifications = experiment[i].getPeptideIdentifications();
+        for (Size j = 0; j < identifications.size(); j++)
         {
-          filterIdentificationsByScore(experiment[i].getPeptideIdentifications()[j], peptide_threshold_score, temp_identification);
-          if (!temp_identification.getHits().empty())
-          {
-            filtered_identifications.push_back(temp_identification);
-          }
+          filterIdentificationsByScore(identifications[j], peptide_threshold_score, identifications[j]);
         }
-        experiment[i].setPeptideIdentifications(filtered_identifications);
-        filtered_identifications.clear();
+        removeEmptyIdentifications_(identifications);
       }
     }
 
@@ -364,35 +309,22 @@ public:
     void filterIdentificationsByBestNHits(MSExperiment<PeakT>& experiment, Size n)
     {
       //filter protein hits
-      ProteinIdentification temp_protein_identification;
-      std::vector<ProteinIdentification> filtered_protein_identifications;
-
-      for (Size j = 0; j < experiment.getProteinIdentifications().size(); j++)
+      std::vector<ProteinIdentification>& protein_identifications = experiment.getProteinIdentifications();
+      for (Size j = 0; j < protein_identifications.size(); j++)
       {
-        filterIdentificationsByBestNHits(experiment.getProteinIdentifications()[j], n, temp_protein_identification);
-        if (!temp_protein_identification.getHits().empty())
-        {
-          filtered_protein_identifications.push_back(temp_protein_identification);
-        }
+        filterIdentificationsByBestNHits(protein_identifications[j], n, protein_identifications[j]);
       }
-      experiment.setProteinIdentifications(filtered_protein_identifications);
+      removeEmptyIdentifications_(protein_identifications);
 
       //filter peptide hits
-      PeptideIdentification temp_identification;
-      std::vector<PeptideIdentification> filtered_identifications;
-
       for (Size i = 0; i < experiment.size(); i++)
       {
-        for (Size j = 0; j < experiment[i].getPeptideIdentifications().size(); j++)
+        std::vector<PeptideIdentification>& identifications = experiment[i].getPeptideIdentifications();
+        for (Size j = 0; j < identifications.size(); j++)
         {
-          filterIdentificationsByBestNHits(experiment[i].getPeptideIdentifications()[j], n, temp_identification);
-          if (!temp_identification.getHits().empty())
-          {
-            filtered_identifications.push_back(temp_identification);
-          }
+          filterIdentificationsByBestNHits(identifications[j], n, identifications[j]);
         }
-        experiment[i].setPeptideIdentifications(filtered_identifications);
-        filtered_identifications.clear();
+        removeEmptyIdentifications_(identifications);
       }
     }
 
@@ -400,27 +332,60 @@ public:
     template <class PeakT>
     void filterIdentificationsByProteins(MSExperiment<PeakT>& experiment, const std::vector<FASTAFile::FASTAEntry>& proteins)
     {
-      std::vector<PeptideIdentification> temp_identifications;
-      std::vector<PeptideIdentification> filtered_identifications;
-      PeptideIdentification temp_identification;
-
       for (Size i = 0; i < experiment.size(); i++)
       {
         if (experiment[i].getMSLevel() == 2)
         {
-          temp_identifications = experiment[i].getPeptideIdentifications();
-          for (Size j = 0; j < temp_identifications.size(); j++)
+          std::vector<PeptideIdentification>& identifications = experiment[i].getPeptideIdentifications();
+          for (Size j = 0; j < identifications.size(); j++)
           {
-            filterIdentificationsByProteins(temp_identifications[j], proteins, temp_identification);
-            if (!temp_identification.getHits().empty())
-            {
-              filtered_identifications.push_back(temp_identification);
-            }
+            filterIdentificationsByProteins(identifications[j], proteins, identifications[j]);
           }
-          experiment[i].setPeptideIdentifications(filtered_identifications);
-          filtered_identifications.clear();
+          removeEmptyIdentifications_(identifications);
+        }
+      }
+    }
+
+protected:
+
+    /**
+      @brief Stores @p hits as the hits of @p filtered_identification, all other members are taken from @p identification
+
+      The hits are swapped in, i.e. @p hits is empty afterwards. If both identifications are the same object, only the hits are replaced.
+    */
+    template <class IdentificationType>
+    static void assignFilteredHits_(const IdentificationType& identification, std::vector<typename IdentificationType::HitType>& hits, IdentificationType& filtered_identification, bool assign_ranks)
+    {
+      if (&identification != &filtered_identification)
+      {
+        filtered_identification = identification;
+      }
+      filtered_identification.getHits().swap(hits);
+      hits.clear();
+      if (assign_ranks)
+      {
+        filtered_identification.assignRanks();
+      }
+    }
+
+    /// removes all identifications without hits (keeping the order of the others)
+    template <class IdentificationType>
+    static void removeEmptyIdentifications_(std::vector<IdentificationType>& identifications)
+    {
+      Size kept = 0;
+      for (Size i = 0; i < identifications.size(); ++i)
+      {
+        if (identifications[i].getHits().empty())
+        {
+          continue;
+        }
+        if (kept != i)
+        {
+          identifications[kept] = identifications[i];
         }
+        ++kept;
       }
+      identifications.erase(identifications.begin() + kept, identifications.end());
     }
 
   };
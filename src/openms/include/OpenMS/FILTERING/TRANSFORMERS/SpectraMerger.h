@@ -232,6 +232,7 @@ public:
         SingleLinkage sl;
         DistanceMatrix<Real> dist;         // will be filled
         ClusterHierarchical ch;
+        ch.setParallel(true); // the distance functor has no state
 
         //ch.setThreshold(0.99);
         // clustering ; threshold is implicitly at 1.0, i.e. distances of 1.0 (== similiarity 0) will not be clustered
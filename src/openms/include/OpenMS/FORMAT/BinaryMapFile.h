@@ -0,0 +1,268 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_FORMAT_BINARYMAPFILE_H
+#define OPENMS_FORMAT_BINARYMAPFILE_H
+
+#include <OpenMS/KERNEL/FeatureMap.h>
+#include <OpenMS/KERNEL/ConsensusMap.h>
+#include <OpenMS/METADATA/ProteinIdentification.h>
+#include <OpenMS/METADATA/PeptideIdentification.h>
+#include <OpenMS/FORMAT/FileTypes.h>
+#include <OpenMS/FORMAT/OPTIONS/FeatureFileOptions.h>
+#include <OpenMS/CONCEPT/ProgressLogger.h>
+
+#include <fstream>
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Binary, column-oriented container for feature maps, consensus maps and identifications (.featureBin / .consensusBin / .idBin)
+
+    This format is meant as a fast replacement for featureXML, consensusXML and idXML
+    between the steps of a pipeline. It stores the same information as the XML
+    formats, so data can be converted back and forth without loss.
+
+    Layout of a file:
+    - a fixed size header (magic number, byte order mark, format version, map kind, feature count and the positions of the sections below)
+    - the features, sorted by RT and m/z and cut into blocks of getBlockSize() features.
+      Within a block, positions, intensities, charges, qualities, widths, unique ids,
+      convex hull points (features) and feature handles (consensus features) are stored
+      as fixed width columns. Peptide identifications, meta values, subordinates, model
+      descriptions and ratios follow as variable length records.
+    - the map level data (document identifier, protein and unassigned peptide identifications,
+      data processing, file descriptions of consensus maps)
+    - a string pool holding meta value keys, identifiers, accessions and sequences only once
+    - the block index, holding the RT, m/z and intensity range of every block
+
+    All sections can be zlib compressed (see setCompression()). The original order of the
+    features is recorded and restored when loading.
+
+    Since the blocks are sorted by position, the RT, m/z and intensity ranges of the
+    FeatureFileOptions (see getOptions()) are used to read only the blocks overlapping the
+    requested region; all other blocks are skipped without being read from disk.
+
+    Identification files (idBin) store one row per peptide identification in their original
+    order. RT, m/z, thresholds, scores, ranks, charges and flanking amino acids are columns;
+    identifiers, score types, sequences and protein accessions are columns of string pool
+    indices, so each distinct sequence and accession is stored (and parsed when loading) only
+    once. Meta values are kept in a typed side table of records. The RT and m/z ranges of the
+    options select identifications by their "RT" and "MZ" meta values; identifications without
+    these values are skipped if the corresponding range is set.
+
+    Numbers are written in the byte order of the writing machine. Files written on a machine
+    with a different byte order are rejected.
+
+    @ingroup FileIO
+  */
+  class OPENMS_DLLAPI BinaryMapFile :
+    public ProgressLogger
+  {
+public:
+    /// Version of the format written by this class
+    static const UInt VERSION;
+
+    /// Default constructor
+    BinaryMapFile();
+
+    /// Destructor
+    virtual ~BinaryMapFile();
+
+    /**
+      @brief Loads a feature map
+
+      The RT, m/z and intensity ranges as well as the convex hull, subordinate and
+      metadata-only settings of getOptions() are honored.
+
+      @exception Exception::FileNotFound is thrown if the file could not be opened
+      @exception Exception::ParseError is thrown if the file is corrupt, from a newer version or does not contain a feature map
+    */
+    void load(const String & filename, FeatureMap<> & map);
+
+    /**
+      @brief Loads a consensus map
+
+      The RT, m/z and intensity ranges as well as the metadata-only setting of
+      getOptions() are honored.
+
+      @exception Exception::FileNotFound is thrown if the file could not be opened
+      @exception Exception::ParseError is thrown if the file is corrupt, from a newer version or does not contain a consensus map
+    */
+    void load(const String & filename, ConsensusMap & map);
+
+    /**
+      @brief Loads protein and peptide identifications
+
+      The RT and m/z ranges as well as the metadata-only setting of getOptions() are honored.
+
+      @exception Exception::FileNotFound is thrown if the file could not be opened
+      @exception Exception::ParseError is thrown if the file is corrupt, from a newer version or does not contain identifications
+    */
+    void load(const String & filename, std::vector<ProteinIdentification> & protein_ids, std::vector<PeptideIdentification> & peptide_ids, String & document_id);
+
+    /// Loads protein and peptide identifications, ignoring the document id
+    void load(const String & filename, std::vector<ProteinIdentification> & protein_ids, std::vector<PeptideIdentification> & peptide_ids);
+
+    /**
+      @brief Stores a feature map
+
+      @exception Exception::UnableToCreateFile is thrown if the file could not be created
+    */
+    void store(const String & filename, const FeatureMap<> & map);
+
+    /**
+      @brief Stores a consensus map
+
+      @exception Exception::UnableToCreateFile is thrown if the file could not be created
+    */
+    void store(const String & filename, const ConsensusMap & map);
+
+    /**
+      @brief Stores protein and peptide identifications
+
+      @exception Exception::UnableToCreateFile is thrown if the file could not be created
+    */
+    void store(const String & filename, const std::vector<ProteinIdentification> & protein_ids, const std::vector<PeptideIdentification> & peptide_ids, const String & document_id = "");
+
+    /**
+      @brief Returns the number of features (or peptide identifications) stored in the file (reads the header only)
+
+      @exception Exception::FileNotFound is thrown if the file could not be opened
+      @exception Exception::ParseError is thrown if the file is not a binary map file
+    */
+    Size loadSize(const String & filename);
+
+    /**
+      @brief Returns FileTypes::FEATUREBIN, FileTypes::CONSENSUSBIN or FileTypes::IDBIN depending on the kind of data in the header
+
+      Returns FileTypes::UNKNOWN if the file cannot be read or does not start with the magic number of this format.
+    */
+    static FileTypes::Type getTypeByContent(const String & filename);
+
+    /// Mutable access to the options for loading
+    FeatureFileOptions & getOptions();
+
+    /// Non-mutable access to the options for loading
+    const FeatureFileOptions & getOptions() const;
+
+    /// Sets whether stored sections are zlib compressed (default: true)
+    void setCompression(bool compression);
+
+    /// Returns whether stored sections are zlib compressed
+    bool getCompression() const;
+
+    /// Sets the number of features (or peptide identifications) per block (default: 4096)
+    void setBlockSize(Size block_size);
+
+    /// Returns the number of features per block
+    Size getBlockSize() const;
+
+protected:
+    /// Position and size of a section in the file
+    struct Chunk_
+    {
+      UInt64 offset;
+      UInt64 stored_size;
+      UInt64 raw_size;
+
+      Chunk_();
+    };
+
+    /// Index entry of a block of features
+    struct BlockInfo_
+    {
+      Chunk_ chunk;
+      UInt64 size;
+      DoubleReal rt_min;
+      DoubleReal rt_max;
+      DoubleReal mz_min;
+      DoubleReal mz_max;
+      DoubleReal intensity_min;
+      DoubleReal intensity_max;
+    };
+
+    /// File header
+    struct Header_
+    {
+      UInt byte_order;
+      UInt version;
+      UInt kind;
+      UInt compressed;
+      UInt64 size;
+      UInt64 block_count;
+      Chunk_ meta;
+      Chunk_ pool;
+      Chunk_ index;
+
+      Header_();
+    };
+
+    /// Opens @p filename, reads and checks the header, the block index and the string pool
+    void open_(const String & filename, UInt kind, std::ifstream & is, Header_ & header, std::vector<BlockInfo_> & blocks, std::vector<String> & pool) const;
+
+    /// Reads the header; returns false if the magic number does not match
+    static bool readHeader_(std::istream & is, Header_ & header);
+
+    /// Writes the header
+    static void writeHeader_(std::ostream & os, const Header_ & header);
+
+    /// Writes @p raw at the current position of @p os (compressed, if requested and if it saves space)
+    Chunk_ writeChunk_(std::ostream & os, std::vector<char> & raw) const;
+
+    /// Writes the block index
+    Chunk_ writeIndex_(std::ostream & os, const std::vector<BlockInfo_> & blocks) const;
+
+    /// Reads a chunk and decompresses it if needed
+    static void readChunk_(std::istream & is, const Chunk_ & chunk, std::vector<char> & raw, const String & filename);
+
+    /// Returns if a block can contain features in the requested ranges
+    bool overlaps_(const BlockInfo_ & block) const;
+
+    /// Returns if a position lies in the requested ranges
+    bool accepts_(DoubleReal rt, DoubleReal mz, DoubleReal intensity) const;
+
+    /// Options for loading
+    FeatureFileOptions options_;
+
+    /// Compression flag
+    bool compression_;
+
+    /// Features per block
+    Size block_size_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_FORMAT_BINARYMAPFILE_H
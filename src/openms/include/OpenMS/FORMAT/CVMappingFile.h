@@ -76,6 +76,17 @@ public:
     */
     void load(const String & filename, CVMappings & cv_mappings, bool strip_namespaces = false);
 
+    /**
+        @brief Returns process-wide shared CvMappings of the given file (looked up with File::find())
+
+        The mappings are loaded when first requested and shared by all later requests for the same file.
+        They are never modified or destroyed. This method is thread-safe.
+
+        @exception Exception::FileNotFound is thrown if the file could not be found or opened
+        @exception Exception::ParseError is thrown if an error occurs during parsing
+    */
+    static const CVMappings & getShared(const String & filename);
+
 protected:
 
     // Docu in base class
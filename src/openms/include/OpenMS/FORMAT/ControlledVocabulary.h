@@ -110,6 +110,26 @@ public:
     ///Destructor
     virtual ~ControlledVocabulary();
 
+    /**
+        @brief Returns a process-wide shared CV loaded from OBO files
+
+        The CV is built by calling loadFromOBO() with each name in @p names and the corresponding file in @p filenames (looked up with File::find()).
+        It is loaded when first requested and then shared by all later requests for the same names and files, e.g. by all file handlers of a process.
+        The returned CV is never modified or destroyed. This method is thread-safe.
+
+        @exception Exception::InvalidParameter is thrown if @p names and @p filenames differ in size
+        @exception Exception::FileNotFound is thrown if a file could not be found or opened
+        @exception Exception::ParseError is thrown if an error occurs during parsing
+    */
+    static const ControlledVocabulary& getShared(const StringList& names, const StringList& filenames);
+
+    /**
+        @brief Returns the shared CV used for mzML (PSI-MS, PATO, UO, BTO and GO)
+
+        @see getShared()
+    */
+    static const ControlledVocabulary& getPSIMSCV();
+
     /// Returns the CV name (set in the load method)
     const String& name() const;
 
@@ -38,12 +38,34 @@
 #include <OpenMS/CONCEPT/Exception.h>
 #include <OpenMS/DATASTRUCTURES/String.h>
 
+#include <fstream>
+#include <utility>
 #include <vector>
 
 namespace OpenMS
 {
   /**
     @brief This class serves for reading in FASTA files
+
+    Besides loading/storing a complete database (load() and store()), which
+    holds all entries in memory, FASTA files can be read and written as a stream,
+    one entry at a time:
+
+    @code
+    FASTAFile f;
+    FASTAFile::FASTAEntry entry;
+    f.readStart("db.fasta");
+    while (f.readNext(entry))
+    {
+      // use entry (its memory is reused by the next call)
+    }
+    @endcode
+
+    For parallel processing, a file can be split into byte ranges at entry
+    boundaries (see getChunks()). Each range is read by its own FASTAFile instance
+    using readStart(filename, begin, end).
+
+    Writing works the same way using writeStart(), writeNext() and writeEnd().
   */
   class OPENMS_DLLAPI FASTAFile
   {
@@ -87,12 +109,18 @@ public:
 
     };
 
-    /// Copy constructor
+    /// Default constructor
     FASTAFile();
 
+    /// Copy constructor (the state of streaming read/write operations is not copied)
+    FASTAFile(const FASTAFile& rhs);
+
     /// Destructor
     virtual ~FASTAFile();
 
+    /// Assignment operator (the state of streaming read/write operations is not copied)
+    FASTAFile& operator=(const FASTAFile& rhs);
+
     /**
       @brief loads a FASTA file given by 'filename' and stores the information in 'data'
 
@@ -108,6 +136,90 @@ public:
     */
     void store(const String& filename, const std::vector<FASTAEntry>& data) const;
 
+    /**
+      @brief Prepares streaming reading of the FASTA file @p filename (see readNext())
+
+      Reads up to the first header line, so a file which is not in FASTA format is detected here.
+
+      @exception Exception::FileNotFound is thrown if the file does not exists.
+      @exception Exception::FileNotReadable is thrown if the file is not readable.
+      @exception Exception::ParseError is thrown if the file does not start with a header line.
+    */
+    void readStart(const String& filename);
+
+    /**
+      @brief Prepares streaming reading of all entries of @p filename whose header starts within the byte range [@p begin, @p end)
+
+      Use getChunks() to obtain ranges which partition a file.
+
+      @exception Exception::FileNotFound is thrown if the file does not exists.
+      @exception Exception::FileNotReadable is thrown if the file is not readable.
+      @exception Exception::ParseError is thrown if @p begin is 0 and the file does not start with a header line.
+    */
+    void readStart(const String& filename, UInt64 begin, UInt64 end);
+
+    /**
+      @brief Reads the next entry of the file opened by readStart()
+
+      The strings of @p entry are overwritten (but their memory is reused). Lines are not checked any
+      further, so no exception is thrown once readStart() succeeded.
+
+      @return false if there are no more entries (in the range), true otherwise
+    */
+    bool readNext(FASTAEntry& entry);
+
+    /// Returns the current byte position of the reader (e.g. for progress reporting)
+    UInt64 readPosition() const;
+
+    /**
+      @brief Splits the file @p filename into (at most) @p count byte ranges of similar size, each starting at an entry header
+
+      The ranges are returned as [begin, end) pairs and cover the whole file.
+
+      @exception Exception::FileNotFound is thrown if the file does not exists.
+    */
+    static std::vector<std::pair<UInt64, UInt64> > getChunks(const String& filename, Size count);
+
+    /**
+      @brief Prepares streaming writing of entries to @p filename (see writeNext() and writeEnd())
+
+      @exception Exception::UnableToCreateFile is thrown if the process is not able to write the file.
+    */
+    void writeStart(const String& filename);
+
+    /// Writes a single entry to the file opened by writeStart()
+    void writeNext(const FASTAEntry& entry);
+
+    /// Closes the file opened by writeStart()
+    void writeEnd();
+
+protected:
+
+    /// Writes @p entry to @p out
+    static void writeEntry_(std::ostream& out, const FASTAEntry& entry);
+
+    /// Input stream for readStart()/readNext()
+    std::ifstream infile_;
+    /// Buffer of the input stream
+    std::vector<char> infile_buffer_;
+    /// Name of the file being read (for error messages)
+    String infile_name_;
+    /// Current line (reused to avoid allocations)
+    std::string line_;
+    /// Header line of the next entry (without the leading '>')
+    std::string next_header_;
+    /// Is there another entry (i.e. has next_header_ been read)?
+    bool has_next_header_;
+    /// Byte offset of the next unread line
+    UInt64 read_offset_;
+    /// Byte offset of the header line of the next entry
+    UInt64 next_header_offset_;
+    /// End of the byte range to read (exclusive)
+    UInt64 read_end_;
+
+    /// Output stream for writeStart()/writeNext()/writeEnd()
+    std::ofstream outfile_;
+
   };
 
 } // namespace OpenMS
@@ -0,0 +1,199 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_FORMAT_FASTAINDEXFILE_H
+#define OPENMS_FORMAT_FASTAINDEXFILE_H
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/DATASTRUCTURES/String.h>
+#include <OpenMS/FORMAT/FASTAFile.h>
+#include <OpenMS/FORMAT/MappedIndexFile.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Persistent, memory-mapped index of a protein database in FASTA format
+
+    Parsing a large FASTA file (e.g. a complete UniProt database) is expensive
+    and usually repeated for every search or indexing run, although the database
+    does not change. This class stores a FASTA file once in a binary layout
+    which can be memory-mapped, so that opening it costs (almost) no time,
+    independent of the database size.
+
+    The index contains
+    - a header with a magic number, the format version, the size, modification time and SHA-1 checksum of the source FASTA file,
+    - offset tables for sequences, identifiers and descriptions (one entry per protein plus a sentinel),
+    - all protein sequences concatenated into a single buffer (whitespace removed, no separators),
+    - all identifiers and all descriptions concatenated into two further buffers.
+
+    Sequences are accessed without copying via getSequence(), which returns a pointer
+    into the mapped file. Use isValidFor() to test whether the index still belongs
+    to a given FASTA file (e.g. after the database was updated).
+
+    The index is written in native byte order and is thus not portable across
+    platforms of different endianness.
+
+    @ingroup FileIO
+  */
+  class OPENMS_DLLAPI FASTAIndexFile
+  {
+public:
+
+    /// Default constructor
+    FASTAIndexFile();
+
+    /// Destructor (unmaps the index if loaded)
+    virtual ~FASTAIndexFile();
+
+    /**
+      @brief Creates an index for the FASTA file @p fasta_filename and stores it in @p index_filename
+
+      @exception Exception::FileNotFound is thrown if the FASTA file does not exist.
+      @exception Exception::ParseError is thrown if the FASTA file could not be parsed.
+      @exception Exception::UnableToCreateFile is thrown if the index file could not be written.
+    */
+    void store(const String& index_filename, const String& fasta_filename) const;
+
+    /**
+      @brief Memory-maps the index file @p index_filename
+
+      A previously loaded index is unloaded first.
+
+      @exception Exception::FileNotFound is thrown if the index file does not exist.
+      @exception Exception::ParseError is thrown if the file is not a valid index (wrong magic number, version or size).
+    */
+    void load(const String& index_filename);
+
+    /// Releases the memory-mapping (if any)
+    void unload();
+
+    /// Returns if an index is currently loaded
+    bool isLoaded() const;
+
+    /**
+      @brief Returns if the loaded index was created from the FASTA file @p fasta_filename
+
+      Compares file size and modification time of @p fasta_filename with the values stored in the index.
+      The SHA-1 checksum is only computed (and compared) if the size matches but the modification time
+      differs (see MappedIndexFile::isUnchanged()).
+      Returns false if no index is loaded or the FASTA file cannot be read.
+    */
+    bool isValidFor(const String& fasta_filename) const;
+
+    /// Returns the SHA-1 checksum (hex string) of the FASTA file the index was created from
+    String getChecksum() const;
+
+    /// Returns the number of proteins in the index
+    Size size() const;
+
+    /// Returns the total number of residues of all proteins
+    Size getTotalSequenceLength() const;
+
+    /// Returns a pointer to the (not null-terminated) sequence of protein @p index; its length is given by getSequenceLength()
+    const char* getSequence(Size index) const;
+
+    /// Returns the length of the sequence of protein @p index
+    Size getSequenceLength(Size index) const;
+
+    /// Returns the identifier (accession) of protein @p index
+    String getIdentifier(Size index) const;
+
+    /// Returns the description of protein @p index
+    String getDescription(Size index) const;
+
+    /// Returns protein @p index as a FASTA entry (copies all strings)
+    FASTAFile::FASTAEntry getEntry(Size index) const;
+
+    /**
+      @brief Computes the SHA-1 checksum (as hex string) of a file (see MappedIndexFile::computeChecksum())
+
+      @exception Exception::FileNotFound is thrown if the file does not exist.
+    */
+    static String computeChecksum(const String& filename);
+
+    /// Default file extension of index files (appended to the FASTA file name)
+    static const String DEFAULT_EXTENSION;
+
+protected:
+
+    /// Fixed-size header at the beginning of each index file
+    struct Header
+    {
+      char magic[8];
+      UInt64 version;
+      UInt64 fasta_size;
+      UInt64 fasta_mtime;
+      char checksum[40];
+      UInt64 protein_count;
+      UInt64 sequence_bytes;
+      UInt64 identifier_bytes;
+      UInt64 description_bytes;
+    };
+
+    /// Returns the part of the @p pool which is delimited by @p offsets[index] and @p offsets[index + 1]
+    String getPoolString_(const UInt64* offsets, const char* pool, Size index) const;
+
+    /// The mapped index file
+    MappedIndexFile mapping_;
+
+    /// Pointer to header (within the mapped region)
+    const Header* header_;
+    /// Sequence offsets (protein_count + 1 entries)
+    const UInt64* sequence_offsets_;
+    /// Identifier offsets (protein_count + 1 entries)
+    const UInt64* identifier_offsets_;
+    /// Description offsets (protein_count + 1 entries)
+    const UInt64* description_offsets_;
+    /// Concatenated sequences
+    const char* sequences_;
+    /// Concatenated identifiers
+    const char* identifiers_;
+    /// Concatenated descriptions
+    const char* descriptions_;
+
+private:
+
+    /// Not implemented (the mapping cannot be shared)
+    FASTAIndexFile(const FASTAIndexFile&);
+
+    /// Not implemented (the mapping cannot be shared)
+    FASTAIndexFile& operator=(const FASTAIndexFile&);
+
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_FORMAT_FASTAINDEXFILE_H
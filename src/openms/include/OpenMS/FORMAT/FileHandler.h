@@ -43,6 +43,8 @@
 #include <OpenMS/FORMAT/MzXMLFile.h>
 #include <OpenMS/FORMAT/MzMLFile.h>
 #include <OpenMS/FORMAT/FeatureXMLFile.h>
+#include <OpenMS/FORMAT/ConsensusXMLFile.h>
+#include <OpenMS/FORMAT/BinaryMapFile.h>
 #include <OpenMS/FORMAT/MzDataFile.h>
 #include <OpenMS/FORMAT/MascotGenericFile.h>
 #include <OpenMS/FORMAT/MS2File.h>
@@ -110,7 +112,9 @@ public:
       @param exp The experiment to load the data into.
       @param force_type Forces to load the file with that file type. If no type is forced, it is determined from the extention ( or from the content if that fails).
       @param log Progress logging mode
-      @param compute_hash Computes a hash value for the loaded file and stores it in the SourceFile
+      @param compute_hash Computes a hash value for the loaded file and stores it in the SourceFile.
+             For uncompressed mzML, mzXML and mzData files, the hash is computed while the file is parsed, so the file is read only once.
+             Hashes are remembered (by path, size and modification time), so files loaded again are not hashed again.
 
       @return true if the file could be loaded, false otherwise
 
@@ -138,6 +142,14 @@ public:
         }
       }
 
+      // SHA-1 hash of the file (computed while parsing, if possible)
+      String hash;
+      if (compute_hash)
+      {
+        hash = getCachedFileHash_(filename);
+      }
+      const bool hash_while_parsing = compute_hash && hash.empty();
+
       //load right file
       switch (type)
       {
@@ -162,7 +174,12 @@ public:
         MzXMLFile f;
         f.getOptions() = options_;
         f.setLogType(log);
+        f.setComputeChecksum(hash_while_parsing);
         f.load(filename, exp);
+        if (hash_while_parsing)
+        {
+          hash = f.getChecksum();
+        }
       }
 
       break;
@@ -172,7 +189,12 @@ public:
         MzDataFile f;
         f.getOptions() = options_;
         f.setLogType(log);
+        f.setComputeChecksum(hash_while_parsing);
         f.load(filename, exp);
+        if (hash_while_parsing)
+        {
+          hash = f.getChecksum();
+        }
       }
       break;
 
@@ -181,7 +203,12 @@ public:
         MzMLFile f;
         f.getOptions() = options_;
         f.setLogType(log);
+        f.setComputeChecksum(hash_while_parsing);
         f.load(filename, exp);
+        if (hash_while_parsing)
+        {
+          hash = f.getChecksum();
+        }
         ChromatogramTools().convertSpectraToChromatograms<MSExperiment<PeakType> >(exp, true);
       }
       break;
@@ -227,7 +254,15 @@ public:
 
       if (compute_hash)
       {
-        src_file.setChecksum(computeFileHash_(filename), SourceFile::SHA1);
+        if (hash.empty()) // not hashed while parsing (other formats, compressed files)
+        {
+          hash = computeFileHash_(filename);
+        }
+        else
+        {
+          cacheFileHash_(filename, hash);
+        }
+        src_file.setChecksum(hash, SourceFile::SHA1);
       }
 
       exp.getSourceFiles().clear();
@@ -347,6 +382,10 @@ public:
       {
         FeatureXMLFile().load(filename, map);
       }
+      else if (type == FileTypes::FEATUREBIN)
+      {
+        BinaryMapFile().load(filename, map);
+      }
       else if (type == FileTypes::TSV)
       {
         MsInspectFile().load(filename, map);
@@ -367,6 +406,63 @@ public:
       return true;
     }
 
+    /**
+      @brief Stores a FeatureMap
+
+      The format is determined by the file name: featureBin files are written in the binary map format, everything else as featureXML.
+
+      @exception Exception::UnableToCreateFile is thrown if the file could not be written
+    */
+    void storeFeatures(const String& filename, const FeatureMap<>& map);
+
+    /**
+      @brief Loads a file into a ConsensusMap
+
+      @param filename the file name of the file to load.
+      @param map The ConsensusMap to load the data into.
+      @param force_type Forces to load the file with that file type. If no type is forced, it is determined from the extention (or from the content if that fails).
+
+      @return true if the file could be loaded, false otherwise
+
+      @exception Exception::FileNotFound is thrown if the file could not be opened
+      @exception Exception::ParseError is thrown if an error occurs during parsing
+    */
+    bool loadConsensusFeatures(const String& filename, ConsensusMap& map, FileTypes::Type force_type = FileTypes::UNKNOWN);
+
+    /**
+      @brief Stores a ConsensusMap
+
+      The format is determined by the file name: consensusBin files are written in the binary map format, everything else as consensusXML.
+
+      @exception Exception::UnableToCreateFile is thrown if the file could not be written
+    */
+    void storeConsensusFeatures(const String& filename, const ConsensusMap& map);
+
+    /**
+      @brief Loads protein and peptide identifications from an idXML or idBin file
+
+      @param filename the file name of the file to load.
+      @param protein_ids The protein identifications
+      @param peptide_ids The peptide identifications
+      @param document_id The document id of the file
+      @param force_type Forces to load the file with that file type. If no type is forced, it is determined from the extention (or from the content if that fails).
+
+      @return true if the file could be loaded, false otherwise
+
+      @exception Exception::FileNotFound is thrown if the file could not be opened
+      @exception Exception::ParseError is thrown if an error occurs during parsing
+    */
+    bool loadIdentifications(const String& filename, std::vector<ProteinIdentification>& protein_ids, std::vector<PeptideIdentification>& peptide_ids, String& document_id, FileTypes::Type force_type = FileTypes::UNKNOWN);
+
+    /**
+      @brief Stores protein and peptide identifications
+
+      The format is determined by the file name: idBin files are written in the binary format, everything else as idXML.
+
+      @exception Exception::UnableToCreateFile is thrown if the file could not be written
+    */
+    void storeIdentifications(const String& filename, const std::vector<ProteinIdentification>& protein_ids, const std::vector<PeptideIdentification>& peptide_ids, const String& document_id = "");
+
 private:
     PeakFileOptions options_;
 
@@ -376,6 +472,12 @@ private:
       @return The SHA-1 hash of the given file.
     */
     String computeFileHash_(const String& filename) const;
+
+    /// Returns the remembered SHA-1 hash of the given file, or an empty string if the file was not hashed before or has changed since (size or modification time)
+    String getCachedFileHash_(const String& filename) const;
+
+    /// Remembers the SHA-1 hash of the given file (for all FileHandler instances of this process)
+    void cacheFileHash_(const String& filename, const String& hash) const;
   };
 
 } //namespace
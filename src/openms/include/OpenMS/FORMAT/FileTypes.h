@@ -98,6 +98,9 @@ namespace OpenMS
       ANALYSISXML,        ///< analysisXML format
       XSD,                ///< XSD schema format
       PSQ,                ///< NCBI binary blast db
+      FEATUREBIN,         ///< %OpenMS binary feature map format (.featureBin)
+      CONSENSUSBIN,       ///< %OpenMS binary consensus map format (.consensusBin)
+      IDBIN,              ///< %OpenMS binary identification format (.idBin)
       SIZE_OF_TYPE        ///< No file type. Simply stores the number of types
     };
 
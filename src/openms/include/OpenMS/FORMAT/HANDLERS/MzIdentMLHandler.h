@@ -99,10 +99,8 @@ protected:
       /// Progress logger
       const ProgressLogger & logger_;
 
-      ///Controlled vocabulary (psi-ms from OpenMS/share/OpenMS/CV/psi-ms.obo)
-      ControlledVocabulary cv_;
-      ///Controlled vocabulary for modifications (unimod from OpenMS/share/OpenMS/CV/unimod.obo)
-      ControlledVocabulary unimod_;
+      ///Controlled vocabulary (psi-ms from OpenMS/share/OpenMS/CV/psi-ms.obo), shared by all handlers
+      const ControlledVocabulary & cv_;
 
       //~ MSExperiment<>* ms_exp_;
 
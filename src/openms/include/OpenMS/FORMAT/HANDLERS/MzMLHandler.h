@@ -115,16 +115,11 @@ public:
         scan_count(0),
         chromatogram_count(0),
         skip_chromatogram_(false),
-        skip_spectrum_(false) /* ,
+        skip_spectrum_(false),
+        cv_(ControlledVocabulary::getPSIMSCV()),
+        mapping_(CVMappingFile::getShared("/MAPPING/ms-mapping.xml")) /* ,
                 validator_(mapping_, cv_) */
       {
-        cv_.loadFromOBO("MS", File::find("/CV/psi-ms.obo"));
-        cv_.loadFromOBO("PATO", File::find("/CV/quality.obo"));
-        cv_.loadFromOBO("UO", File::find("/CV/unit.obo"));
-        cv_.loadFromOBO("BTO", File::find("/CV/brenda.obo"));
-        cv_.loadFromOBO("GO", File::find("/CV/goslim_goa.obo"));
-
-        CVMappingFile().load(File::find("/MAPPING/ms-mapping.xml"), mapping_);
         //~ validator_ = Internal::MzMLValidator(mapping_, cv_);
 
         // check the version number of the mzML handler
@@ -151,16 +146,11 @@ public:
         scan_count(0),
         chromatogram_count(0),
         skip_chromatogram_(false),
-        skip_spectrum_(false) /* ,
+        skip_spectrum_(false),
+        cv_(ControlledVocabulary::getPSIMSCV()),
+        mapping_(CVMappingFile::getShared("/MAPPING/ms-mapping.xml")) /* ,
                 validator_(mapping_, cv_) */
       {
-        cv_.loadFromOBO("MS", File::find("/CV/psi-ms.obo"));
-        cv_.loadFromOBO("PATO", File::find("/CV/quality.obo"));
-        cv_.loadFromOBO("UO", File::find("/CV/unit.obo"));
-        cv_.loadFromOBO("BTO", File::find("/CV/brenda.obo"));
-        cv_.loadFromOBO("GO", File::find("/CV/goslim_goa.obo"));
-
-        CVMappingFile().load(File::find("/MAPPING/ms-mapping.xml"), mapping_);
         //~ validator_ = Internal::MzMLValidator(mapping_, cv_);
 
         // check the version number of the mzML handler
@@ -303,9 +293,10 @@ protected:
       bool skip_chromatogram_;
       bool skip_spectrum_;
 
-      ///Controlled vocabulary (psi-ms from OpenMS/share/OpenMS/CV/psi-ms.obo)
-      ControlledVocabulary cv_;
-      CVMappings mapping_;
+      ///Controlled vocabulary (psi-ms from OpenMS/share/OpenMS/CV/psi-ms.obo), shared by all handlers
+      const ControlledVocabulary& cv_;
+      ///CV mapping rules of mzML, shared by all handlers
+      const CVMappings& mapping_;
       //~ Internal::MzMLValidator validator_;
 
       ///Count of selected ions
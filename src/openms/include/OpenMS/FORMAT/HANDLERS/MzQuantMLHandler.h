@@ -86,8 +86,8 @@ protected:
       /// Progress logger
       const ProgressLogger & logger_;
 
-      /// Controlled vocabulary (hopefully the psi-pi from OpenMS/share/OpenMS/CV/psi-pi.obo)
-      ControlledVocabulary cv_;
+      /// Controlled vocabulary (hopefully the psi-pi from OpenMS/share/OpenMS/CV/psi-pi.obo), shared by all handlers
+      const ControlledVocabulary & cv_;
 
       String tag_;
 
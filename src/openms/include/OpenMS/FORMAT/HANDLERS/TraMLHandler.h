@@ -89,8 +89,8 @@ protected:
       /// Progress logger
       const ProgressLogger & logger_;
 
-      ///Controlled vocabulary (psi-ms from OpenMS/share/OpenMS/CV/psi-ms.obo)
-      ControlledVocabulary cv_;
+      ///Controlled vocabulary (psi-ms from OpenMS/share/OpenMS/CV/psi-ms.obo), shared by all handlers
+      const ControlledVocabulary & cv_;
 
       String tag_;
 
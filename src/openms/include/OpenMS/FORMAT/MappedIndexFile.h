@@ -0,0 +1,138 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_FORMAT_MAPPEDINDEXFILE_H
+#define OPENMS_FORMAT_MAPPEDINDEXFILE_H
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/DATASTRUCTURES/String.h>
+
+namespace boost
+{
+  namespace interprocess
+  {
+    class file_mapping;
+    class mapped_region;
+  }
+}
+
+namespace OpenMS
+{
+  /**
+    @brief Read-only memory mapping of a persistent binary index file
+
+    Shared by the index files which are memory-mapped instead of parsed (FASTAIndexFile,
+    SpectralLibraryIndexFile). All of them start with an 8 byte magic number followed by
+    the format version (UInt64), which map() checks before the caller interprets the rest.
+
+    The static members test whether the source file an index was created from is unchanged.
+    Size and modification time are compared first; the SHA-1 checksum of the source file is
+    only computed if the size matches but the modification time does not.
+
+    @ingroup FileIO
+  */
+  class OPENMS_DLLAPI MappedIndexFile
+  {
+public:
+
+    /// Default constructor
+    MappedIndexFile();
+
+    /// Destructor (unmaps the file if mapped)
+    ~MappedIndexFile();
+
+    /**
+      @brief Maps the file @p filename and checks its magic number and version
+
+      A previously mapped file is unmapped first. @p description names the kind of index in error messages (e.g. "FASTA index").
+
+      @exception Exception::FileNotFound is thrown if the file does not exist.
+      @exception Exception::FileNotReadable is thrown if the file is not readable.
+      @exception Exception::ParseError is thrown if the file cannot be mapped, is smaller than @p header_size or has a different magic number or version.
+    */
+    void map(const String& filename, const char magic[8], UInt64 version, Size header_size, const String& description);
+
+    /// Releases the mapping (if any)
+    void unmap();
+
+    /// Returns if a file is currently mapped
+    bool isMapped() const;
+
+    /// Returns the start of the mapped file (0 if no file is mapped)
+    const char* getData() const;
+
+    /// Returns the size of the mapped file in bytes (0 if no file is mapped)
+    Size getSize() const;
+
+    /// Returns the size of @p filename in bytes (0 if it does not exist)
+    static UInt64 getFileSize(const String& filename);
+
+    /// Returns the last modification time of @p filename in seconds since the epoch (0 if it does not exist)
+    static UInt64 getModificationTime(const String& filename);
+
+    /**
+      @brief Computes the SHA-1 checksum (as hex string) of a file
+
+      @exception Exception::FileNotFound is thrown if the file does not exist.
+    */
+    static String computeChecksum(const String& filename);
+
+    /**
+      @brief Returns if @p filename still has the given @p size, @p modification_time and @p checksum
+
+      If size and modification time match, the file is taken as unchanged without computing its checksum.
+      Returns false if the file is not readable.
+    */
+    static bool isUnchanged(const String& filename, UInt64 size, UInt64 modification_time, const String& checksum);
+
+protected:
+
+    /// The mapped file
+    boost::interprocess::file_mapping* file_;
+    /// The mapped region of the file
+    boost::interprocess::mapped_region* region_;
+
+private:
+
+    /// Not implemented (the mapping cannot be shared)
+    MappedIndexFile(const MappedIndexFile&);
+
+    /// Not implemented (the mapping cannot be shared)
+    MappedIndexFile& operator=(const MappedIndexFile&);
+
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_FORMAT_MAPPEDINDEXFILE_H
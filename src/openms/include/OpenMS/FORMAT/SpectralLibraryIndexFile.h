@@ -0,0 +1,221 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Andreas Bertsch $
+// $Authors: Andreas Bertsch $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_FORMAT_SPECTRALLIBRARYINDEXFILE_H
+#define OPENMS_FORMAT_SPECTRALLIBRARYINDEXFILE_H
+
+#include <OpenMS/CONCEPT/Exception.h>
+#include <OpenMS/DATASTRUCTURES/String.h>
+#include <OpenMS/KERNEL/StandardTypes.h>
+#include <OpenMS/FORMAT/MappedIndexFile.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Persistent, memory-mapped index of a searchable spectral library in MSP format
+
+    Spectral library search needs the library spectra in a preprocessed form and, for
+    every query, all library spectra whose precursor m/z lies within the precursor mass
+    tolerance. Parsing and preprocessing a large library (millions of spectra) takes much
+    longer than the search itself, so this class stores the preprocessed library once in a
+    binary layout which can be memory-mapped.
+
+    The index contains
+    - a header with a magic number, the format version, the size, modification time and SHA-1 checksum of the source MSP file and the intensity threshold used for preprocessing,
+    - the precursor m/z values of all spectra in ascending order, followed by their retention times,
+    - offset tables for the peaks and the peptide sequences (one entry per spectrum plus a sentinel),
+    - the m/z values and the (square root transformed) intensities of all peaks, concatenated in the order of the spectra,
+    - the precursor charges and the peptide sequences (as strings) of all spectra.
+
+    Since the spectra are sorted by precursor m/z, the candidates of a query are found by
+    binary search (see findPrecursorRange()). Peaks are accessed without copying via
+    getMZs() and getIntensities(), which return pointers into the mapped file.
+
+    Preprocessing is the same as done by @ref TOPP_SpecLibSearcher before: peaks with an
+    intensity not above the threshold are removed, the intensities of the remaining peaks are
+    replaced by their square root (unannotated peaks, i.e. annotations starting with '?', are
+    down-weighted by a factor of 0.2 before). Library spectra without precursor or peptide
+    identification are skipped.
+
+    The index is written in native byte order and is thus not portable across
+    platforms of different endianness.
+
+    @ingroup FileIO
+  */
+  class OPENMS_DLLAPI SpectralLibraryIndexFile
+  {
+public:
+
+    /// Default constructor
+    SpectralLibraryIndexFile();
+
+    /// Destructor (unmaps the index if loaded)
+    virtual ~SpectralLibraryIndexFile();
+
+    /**
+      @brief Creates an index for the MSP file @p msp_filename and stores it in @p index_filename
+
+      @param index_filename The index file to create
+      @param msp_filename The spectral library
+      @param min_intensity Peaks with an intensity not above this threshold are removed
+
+      @exception Exception::FileNotFound is thrown if the MSP file does not exist.
+      @exception Exception::ParseError is thrown if the MSP file could not be parsed.
+      @exception Exception::UnableToCreateFile is thrown if the index file could not be written.
+    */
+    void store(const String & index_filename, const String & msp_filename, DoubleReal min_intensity) const;
+
+    /**
+      @brief Memory-maps the index file @p index_filename
+
+      A previously loaded index is unloaded first.
+
+      @exception Exception::FileNotFound is thrown if the index file does not exist.
+      @exception Exception::ParseError is thrown if the file is not a valid index (wrong magic number, version or size).
+    */
+    void load(const String & index_filename);
+
+    /// Releases the memory-mapping (if any)
+    void unload();
+
+    /// Returns if an index is currently loaded
+    bool isLoaded() const;
+
+    /**
+      @brief Returns if the loaded index was created from the MSP file @p msp_filename with the intensity threshold @p min_intensity
+
+      Compares the threshold and the file size and modification time of @p msp_filename with the values stored in the index.
+      The SHA-1 checksum is only computed if the size matches but the modification time differs (see MappedIndexFile::isUnchanged()).
+      Returns false if no index is loaded or the MSP file cannot be read.
+    */
+    bool isValidFor(const String & msp_filename, DoubleReal min_intensity) const;
+
+    /// Returns the SHA-1 checksum (hex string) of the MSP file the index was created from
+    String getChecksum() const;
+
+    /// Returns the intensity threshold used for preprocessing
+    DoubleReal getMinIntensity() const;
+
+    /// Returns the number of spectra in the index
+    Size size() const;
+
+    /// Returns the total number of peaks of all spectra
+    Size getTotalPeakCount() const;
+
+    /**
+      @brief Finds the spectra with a precursor m/z in the interval [@p min_mz, @p max_mz] (binary search)
+
+      The spectra are given by the half-open index range [@p first, @p last), which is empty if there are none.
+    */
+    void findPrecursorRange(DoubleReal min_mz, DoubleReal max_mz, Size & first, Size & last) const;
+
+    /// Returns the precursor m/z of spectrum @p index
+    DoubleReal getPrecursorMZ(Size index) const;
+
+    /// Returns the retention time of spectrum @p index
+    DoubleReal getRT(Size index) const;
+
+    /// Returns the precursor charge of spectrum @p index
+    Int getCharge(Size index) const;
+
+    /// Returns the peptide sequence (as string) of spectrum @p index
+    String getSequence(Size index) const;
+
+    /// Returns the number of peaks of spectrum @p index
+    Size getPeakCount(Size index) const;
+
+    /// Returns a pointer to the m/z values of the peaks of spectrum @p index (getPeakCount() values, ascending)
+    const DoubleReal * getMZs(Size index) const;
+
+    /// Returns a pointer to the intensities of the peaks of spectrum @p index (getPeakCount() values)
+    const Real * getIntensities(Size index) const;
+
+    /// Replaces the content of @p spectrum by the peaks, the precursor and the retention time of spectrum @p index
+    void getSpectrum(Size index, PeakSpectrum & spectrum) const;
+
+    /// Default file extension of index files (appended to the MSP file name)
+    static const String DEFAULT_EXTENSION;
+
+protected:
+
+    /// Fixed-size header at the beginning of each index file
+    struct Header
+    {
+      char magic[8];
+      UInt64 version;
+      UInt64 msp_size;
+      UInt64 msp_mtime;
+      char checksum[40];
+      DoubleReal min_intensity;
+      UInt64 spectrum_count;
+      UInt64 peak_count;
+      UInt64 sequence_bytes;
+    };
+
+    /// The mapped index file
+    MappedIndexFile mapping_;
+
+    /// Pointer to header (within the mapped region)
+    const Header * header_;
+    /// Precursor m/z values (ascending)
+    const DoubleReal * precursor_mzs_;
+    /// Retention times
+    const DoubleReal * rts_;
+    /// Peak offsets (spectrum_count + 1 entries)
+    const UInt64 * peak_offsets_;
+    /// Sequence offsets (spectrum_count + 1 entries)
+    const UInt64 * sequence_offsets_;
+    /// m/z values of all peaks
+    const DoubleReal * peak_mzs_;
+    /// Intensities of all peaks
+    const Real * peak_intensities_;
+    /// Precursor charges
+    const Int32 * charges_;
+    /// Concatenated sequences
+    const char * sequences_;
+
+private:
+
+    /// Not implemented (the mapping cannot be shared)
+    SpectralLibraryIndexFile(const SpectralLibraryIndexFile &);
+
+    /// Not implemented (the mapping cannot be shared)
+    SpectralLibraryIndexFile & operator=(const SpectralLibraryIndexFile &);
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_FORMAT_SPECTRALLIBRARYINDEXFILE_H
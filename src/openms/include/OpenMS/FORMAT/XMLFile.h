@@ -73,6 +73,19 @@ public:
       ///return the version of the schema
       const String & getVersion() const;
 
+      /**
+        @brief Sets whether the SHA-1 checksum of a file is computed while it is parsed (default: false)
+
+        The checksum is computed from the bytes the parser reads, so the file is read only once.
+        For compressed files, no checksum is computed.
+
+        @see getChecksum()
+      */
+      void setComputeChecksum(bool compute);
+
+      /// Returns the SHA-1 checksum (hexadecimal) of the file parsed last, or an empty string if it was not computed
+      const String & getChecksum() const;
+
 protected:
       /**
         @brief Parses the XML file given by @p filename using the handler given by @p handler.
@@ -98,6 +111,12 @@ protected:
       /// Encoding string that replaces the encoding (system dependend or specified in the XML). Disabled if empty. Used as a workaround for XTandem output xml.
       String enforced_encoding_;
 
+      /// Compute the checksum of parsed files?
+      bool compute_checksum_;
+
+      /// SHA-1 checksum of the file parsed last
+      String checksum_;
+
       void enforceEncoding_(const String& encoding);
     };
 
@@ -23,6 +23,7 @@ source_group("Source Files\\OpenMS\\FORMAT" FILES ${mocced_sources})
 ### list all header files of the directory here
 set(sources_list_h
 Base64.h
+BinaryMapFile.h
 Bzip2Ifstream.h
 Bzip2InputStream.h
 CompressedInputSource.h
@@ -34,6 +35,7 @@ DTA2DFile.h
 DTAFile.h
 EDTAFile.h
 FASTAFile.h
+FASTAIndexFile.h
 FastaIterator.h
 FastaIteratorIntern.h
 FeatureXMLFile.h
@@ -48,6 +50,7 @@ KroenikFile.h
 LibSVMEncoder.h
 MS2File.h
 MSPFile.h
+MappedIndexFile.h
 MascotInfile.h
 MascotGenericFile.h
 MascotRemoteQuery.h
@@ -71,6 +74,7 @@ ProtXMLFile.h
 SequestInfile.h
 SequestOutfile.h
 SpecArrayFile.h
+SpectralLibraryIndexFile.h
 SVOutStream.h
 TextFile.h
 ToolDescriptionFile.h
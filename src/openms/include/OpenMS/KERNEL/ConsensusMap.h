@@ -42,6 +42,7 @@
 #include <OpenMS/KERNEL/ComparatorUtils.h>
 #include <OpenMS/METADATA/ProteinIdentification.h>
 #include <OpenMS/KERNEL/FeatureMap.h>
+#include <OpenMS/KERNEL/FeatureTable.h>
 #include <OpenMS/CONCEPT/UniqueIdIndexer.h>
 
 namespace OpenMS
@@ -253,6 +254,21 @@ public:
       output_map.updateRanges();
     }
 
+    /**
+      @brief Similar to @p convert for FeatureMaps, but for the compact FeatureTable.
+
+      Only the first (!) @p n elements are copied. The convex hulls of the features are not needed for consensus features and are not touched.
+
+      @param input_map_index The index of the input map.
+      @param input_map The feature table to be converted.
+      @param output_map The resulting ConsensusMap.
+      @param n The maximum number of elements to be copied.
+    */
+    OPENMS_DLLAPI static void convert(UInt64 const input_map_index,
+                                      FeatureTable const & input_map,
+                                      ConsensusMap & output_map,
+                                      Size n = -1);
+
     /**
       @brief Similar to @p convert for FeatureMaps.
 
@@ -0,0 +1,294 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Chris Bielow $
+// $Authors: Chris Bielow $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_KERNEL_FEATURETABLE_H
+#define OPENMS_KERNEL_FEATURETABLE_H
+
+#include <OpenMS/KERNEL/FeatureMap.h>
+#include <OpenMS/DATASTRUCTURES/Map.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+
+  /**
+    @brief A compact, column-oriented representation of a feature map.
+
+    Instead of one Feature object per feature, the table stores the properties
+    of all features in contiguous columns (RT, m/z, intensity, charge, overall
+    quality, per-dimension qualities, width, unique id). The convex hulls of
+    all features share one point pool, and peptide identifications, meta
+    values and subordinate features are kept in side tables. Iterating over
+    the positions of all features (e.g. during linking or alignment) thus
+    touches only the columns that are actually needed.
+
+    A feature needs 56 bytes in the columns, plus 8 bytes per convex hull and
+    16 bytes per hull point. Peptide identifications, meta values and
+    subordinates are stored in sparse side tables, i.e. only for the features
+    that have some. The same feature in a FeatureMap needs several hundred
+    bytes (the model description alone holds a Param).
+
+    Use fromFeatureMap() and toFeatureMap() to convert between the two
+    representations. The conversion is lossless except for the model
+    descriptions of the features, which are not stored.
+
+    @see FeatureMap, ConsensusMap::convert()
+
+    @ingroup Kernel
+  */
+  class OPENMS_DLLAPI FeatureTable :
+    public DocumentIdentifier,
+    public UniqueIdInterface
+  {
+public:
+
+    /// Position type of hull points (RT, m/z)
+    typedef DPosition<2> PointType;
+
+    /// Bounding box type
+    typedef DBoundingBox<2> BoundingBoxType;
+
+    /** @name Constructors and Destructor
+    */
+    //@{
+    /// Default constructor
+    FeatureTable();
+
+    /// Copy constructor
+    FeatureTable(const FeatureTable & source);
+
+    /// Constructor from a feature map
+    explicit FeatureTable(const FeatureMap<> & map);
+
+    /// Destructor
+    virtual ~FeatureTable();
+    //@}
+
+    /// Assignment operator
+    FeatureTable & operator=(const FeatureTable & rhs);
+
+    /// Equality operator
+    bool operator==(const FeatureTable & rhs) const;
+
+    /// Equality operator
+    bool operator!=(const FeatureTable & rhs) const;
+
+    /// @name Conversion
+    //@{
+    /// Replaces the content of the table by the features (and meta data) of @p map
+    void fromFeatureMap(const FeatureMap<> & map);
+
+    /// Replaces the content of @p map by the features (and meta data) of the table
+    void toFeatureMap(FeatureMap<> & map) const;
+    //@}
+
+    /// @name Size and content
+    //@{
+    /// Number of features
+    Size size() const;
+
+    /// Returns whether the table contains no features
+    bool empty() const;
+
+    /// Reserves space for @p n features
+    void reserve(Size n);
+
+    /**
+      @brief Clears all data
+
+      @param clear_meta_data If @em true, all meta data (protein and unassigned peptide identifications, data processing, document identifier, unique id) is cleared as well.
+    */
+    void clear(bool clear_meta_data = true);
+
+    /// Appends a feature to the table
+    void push_back(const Feature & feature);
+
+    /// Reconstructs the feature at position @p index (without model description)
+    void getFeature(Size index, Feature & feature) const;
+
+    /// Reconstructs the base feature at position @p index (position, intensity, charge, quality, width, unique id, peptide identifications and meta values)
+    void getBaseFeature(Size index, BaseFeature & feature) const;
+    //@}
+
+    /// @name Columns
+    //@{
+    /// Retention times of all features
+    const std::vector<DoubleReal> & getRTs() const;
+    /// m/z values of all features
+    const std::vector<DoubleReal> & getMZs() const;
+    /// Intensities of all features
+    const std::vector<Feature::IntensityType> & getIntensities() const;
+    /// Charges of all features
+    const std::vector<Feature::ChargeType> & getCharges() const;
+    /// Overall qualities of all features
+    const std::vector<Feature::QualityType> & getOverallQualities() const;
+    /// Widths of all features
+    const std::vector<Feature::WidthType> & getWidths() const;
+    /// Unique ids of all features
+    const std::vector<UInt64> & getUniqueIds() const;
+
+    /// Returns the retention time of feature @p index
+    inline DoubleReal getRT(Size index) const
+    {
+      return rt_[index];
+    }
+    /// Sets the retention time of feature @p index (the convex hulls are not changed)
+    inline void setRT(Size index, DoubleReal rt)
+    {
+      rt_[index] = rt;
+    }
+    /// Returns the m/z value of feature @p index
+    inline DoubleReal getMZ(Size index) const
+    {
+      return mz_[index];
+    }
+    /// Sets the m/z value of feature @p index (the convex hulls are not changed)
+    inline void setMZ(Size index, DoubleReal mz)
+    {
+      mz_[index] = mz;
+    }
+    /// Returns the intensity of feature @p index
+    inline Feature::IntensityType getIntensity(Size index) const
+    {
+      return intensity_[index];
+    }
+    /// Returns the charge of feature @p index
+    inline Feature::ChargeType getCharge(Size index) const
+    {
+      return charge_[index];
+    }
+    /// Returns the overall quality of feature @p index
+    inline Feature::QualityType getOverallQuality(Size index) const
+    {
+      return quality_[index];
+    }
+    /// Returns the width of feature @p index
+    inline Feature::WidthType getWidth(Size index) const
+    {
+      return width_[index];
+    }
+    /// Returns the unique id of feature @p index
+    inline UInt64 getUniqueId(Size index) const
+    {
+      return unique_id_[index];
+    }
+    /// The unique id of the table itself (hidden by the overload above otherwise)
+    using UniqueIdInterface::getUniqueId;
+    //@}
+
+    /// @name Convex hulls
+    //@{
+    /// Returns the number of mass trace convex hulls of feature @p index
+    Size getNumberOfConvexHulls(Size index) const;
+
+    /// Reconstructs the mass trace convex hull @p hull_index of feature @p index
+    ConvexHull2D getConvexHull(Size index, Size hull_index) const;
+
+    /// Returns the bounding box of mass trace convex hull @p hull_index of feature @p index
+    BoundingBoxType getConvexHullBoundingBox(Size index, Size hull_index) const;
+
+    /// Returns the bounding box of all convex hulls of feature @p index (empty if there are none)
+    BoundingBoxType getBoundingBox(Size index) const;
+    //@}
+
+    /// @name Side tables
+    //@{
+    /// Non-mutable access to the peptide identifications of feature @p index
+    const std::vector<PeptideIdentification> & getPeptideIdentifications(Size index) const;
+    /// Mutable access to the peptide identifications of feature @p index (creates an entry in the side table)
+    std::vector<PeptideIdentification> & getPeptideIdentifications(Size index);
+
+    /// Non-mutable access to the meta values of feature @p index
+    const MetaInfoInterface & getMetaInfo(Size index) const;
+    /// Mutable access to the meta values of feature @p index (creates an entry in the side table)
+    MetaInfoInterface & getMetaInfo(Size index);
+    //@}
+
+    /// @name Meta data of the map
+    //@{
+    /// Non-mutable access to the protein identifications
+    const std::vector<ProteinIdentification> & getProteinIdentifications() const;
+    /// Mutable access to the protein identifications
+    std::vector<ProteinIdentification> & getProteinIdentifications();
+    /// Non-mutable access to the unassigned peptide identifications
+    const std::vector<PeptideIdentification> & getUnassignedPeptideIdentifications() const;
+    /// Mutable access to the unassigned peptide identifications
+    std::vector<PeptideIdentification> & getUnassignedPeptideIdentifications();
+    /// Non-mutable access to the data processing
+    const std::vector<DataProcessing> & getDataProcessing() const;
+    /// Mutable access to the data processing
+    std::vector<DataProcessing> & getDataProcessing();
+    //@}
+
+protected:
+
+    /// @name Columns
+    //@{
+    std::vector<DoubleReal> rt_;
+    std::vector<DoubleReal> mz_;
+    std::vector<Feature::IntensityType> intensity_;
+    std::vector<Feature::ChargeType> charge_;
+    std::vector<Feature::QualityType> quality_;
+    std::vector<Feature::QualityType> quality_rt_;
+    std::vector<Feature::QualityType> quality_mz_;
+    std::vector<Feature::WidthType> width_;
+    std::vector<UInt64> unique_id_;
+    //@}
+
+    /// First hull of each feature (index into hull_offsets_), plus one entry for the end
+    std::vector<Size> feature_hulls_;
+    /// First point of each hull (index into hull_points_), plus one entry for the end
+    std::vector<Size> hull_offsets_;
+    /// Points of all hulls
+    std::vector<PointType> hull_points_;
+
+    /// Peptide identifications (only for features that have some)
+    Map<Size, std::vector<PeptideIdentification> > peptides_;
+    /// Meta values (only for features that have some)
+    Map<Size, MetaInfoInterface> meta_;
+    /// Subordinate features (only for features that have some)
+    Map<Size, std::vector<Feature> > subordinates_;
+
+    /// Protein identifications
+    std::vector<ProteinIdentification> protein_identifications_;
+    /// Unassigned peptide identifications
+    std::vector<PeptideIdentification> unassigned_peptide_identifications_;
+    /// Applied data processing
+    std::vector<DataProcessing> data_processing_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_KERNEL_FEATURETABLE_H
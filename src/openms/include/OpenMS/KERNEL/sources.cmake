@@ -15,6 +15,7 @@ DRichPeak.h
 Feature.h
 FeatureHandle.h
 FeatureMap.h
+FeatureTable.h
 MassTrace.h
 MRMFeature.h
 MRMTransitionGroup.h
@@ -169,6 +169,27 @@ private:
       PosteriorErrorProbabilityModel & operator=(const PosteriorErrorProbabilityModel & rhs);
       ///Copy constructor (not implemented)
       PosteriorErrorProbabilityModel(const PosteriorErrorProbabilityModel & rhs);
+
+      /// sums of one E-step of the EM algorithm; the first and second moments are taken around the current means (ref) for numerical stability
+      struct EMSums_
+      {
+        DoubleReal log_likelihood;
+        DoubleReal sum_posterior;
+        DoubleReal one_minus_sum_posterior;
+        DoubleReal negative_ref;
+        DoubleReal negative_x;
+        DoubleReal negative_x2;
+        DoubleReal positive_ref;
+        DoubleReal positive_x;
+        DoubleReal positive_x2;
+      };
+
+      /// computes the log-likelihood and all posterior weighted sums of one E-step in a single pass over the (optionally weighted) scores
+      void computeEMSums_(const std::vector<double> & x_scores, const std::vector<DoubleReal> & weights, const std::vector<DoubleReal> & incorrect_density, const std::vector<DoubleReal> & correct_density, EMSums_ & sums) const;
+      /// like fillDensities() for the two Gaussians used during fitting, returns the (weighted) sum of posterior probabilities using the current prior
+      DoubleReal fillDensitiesSumPosterior_(const std::vector<double> & x_scores, const std::vector<DoubleReal> & weights, std::vector<DoubleReal> & incorrect_density, std::vector<DoubleReal> & correct_density) const;
+      /// bins the sorted scores into a histogram, writing the mean score and the count of each non-empty bin
+      void binScores_(const std::vector<double> & x_scores, Size number_of_bins, std::vector<double> & bin_scores, std::vector<DoubleReal> & bin_weights) const;
       ///stores parameters for incorrectly assigned sequences. If gumbel fit was used, A can be ignored. Furthermore, in this case, x0 and sigma are the local parameter alpha and scale parameter beta, respectively.
       GaussFitter::GaussFitResult incorrectly_assigned_fit_param_;
       ///stores gauss parameters
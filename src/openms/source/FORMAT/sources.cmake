@@ -4,6 +4,7 @@ set(directory source/FORMAT)
 ### list all filenames of the directory here
 set(sources_list
 Base64.C
+BinaryMapFile.C
 Bzip2Ifstream.C
 Bzip2InputStream.C
 CompressedInputSource.C
@@ -15,6 +16,7 @@ DTA2DFile.C
 DTAFile.C
 EDTAFile.C
 FASTAFile.C
+FASTAIndexFile.C
 FastaIterator.C
 FastaIteratorIntern.C
 FeatureXMLFile.C
@@ -30,6 +32,7 @@ KroenikFile.C
 LibSVMEncoder.C
 MS2File.C
 MSPFile.C
+MappedIndexFile.C
 MascotInfile.C
 MascotGenericFile.C
 MascotRemoteQuery.C
@@ -54,6 +57,7 @@ ProtXMLFile.C
 SequestInfile.C
 SequestOutfile.C
 SpecArrayFile.C
+SpectralLibraryIndexFile.C
 SVOutStream.C
 TextFile.C
 ToolDescriptionFile.C
@@ -12,6 +12,7 @@ DRichPeak.C
 Feature.C
 FeatureHandle.C
 FeatureMap.C
+FeatureTable.C
 MassTrace.C
 MRMFeature.C
 MRMTransitionGroup.C
@@ -56,6 +56,7 @@ class QTreeWidget;
 class QTreeWidgetItem;
 class QWebView;
 class QNetworkAccessManager;
+class QAction;
 class QNetworkReply;
 
 namespace OpenMS
@@ -65,6 +66,7 @@ namespace OpenMS
   class TOPPASTabBar;
   class TOPPASLogWindow;
   class TOPPASResources;
+  class TOPPASResultCache;
 
   /**
     @brief Main window of the TOPPAS tool
@@ -197,6 +199,11 @@ protected slots:
     /// user edited the workflow description
     void descriptionUpdated_();
 
+    /// enables or disables the result cache of all pipelines (according to the menu entry)
+    void updateResultCache_();
+    /// removes all results from the result cache (after asking the user)
+    void clearResultCache_();
+
 protected:
 
     /// Log output window
@@ -233,6 +240,12 @@ protected:
     QLabel* message_label_;
     //@}
 
+    /// Menu entry for enabling the result cache (disabled by default, as the cache grows up to TOPPASResultCache::getDefaultSizeLimit())
+    QAction* result_cache_action_;
+
+    /// enables or disables the result cache @p cache (according to the menu entry) and sets its size limit
+    void configureResultCache_(TOPPASResultCache& cache);
+
     ///returns the window with id @p id
     TOPPASWidget* window_(int id) const;
 
@@ -0,0 +1,184 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_VISUAL_INTENSITYTILEPYRAMID_H
+#define OPENMS_VISUAL_INTENSITYTILEPYRAMID_H
+
+//OpenMS
+#include <OpenMS/KERNEL/MSExperiment.h>
+
+//QT
+#include <QtCore/QMutex>
+
+//STL
+#include <vector>
+
+namespace OpenMS
+{
+  class OnDiscSpectrumCache;
+
+  /**
+      @brief Precomputed maximum intensities of a peak map at several resolutions
+
+      The MS1 spectra of a peak map are summarized in a grid of cells, which hold the maximum
+      intensity of all peaks falling into them. The rows of the finest level are groups of
+      consecutive MS1 spectra (a single spectrum if the map is small enough), the columns are
+      bins of equal m/z width. Each coarser level halves the number of rows and columns.
+
+      getMaximumIntensities() renders the maximum intensity of every pixel of a view from the
+      coarsest level that is still at least as fine as the pixels. The time needed is thus
+      proportional to the number of pixels instead of the number of peaks. If the view is
+      zoomed in too far for the finest level, the raw data has to be used instead.
+
+      build() may run in a different thread than the queries. Queries fail until it is done.
+      As build() reads the peak map, the map must not be changed before build() has finished
+      or cancel() has been called.
+
+      @ingroup Visual
+  */
+  class OPENMS_GUI_DLLAPI IntensityTilePyramid
+  {
+public:
+    /// Peak map type
+    typedef MSExperiment<> ExperimentType;
+    /// Spectrum type
+    typedef ExperimentType::SpectrumType SpectrumType;
+
+    /// Default constructor
+    IntensityTilePyramid();
+
+    /// Destructor
+    ~IntensityTilePyramid();
+
+    /**
+      @brief Builds the pyramid from the MS1 spectra of @p map
+
+      @param map The peak map (spectra sorted by RT, peaks sorted by m/z)
+      @param mz_bins Number of m/z bins of the finest level
+      @param max_cells Maximum number of cells of the finest level (consecutive spectra are merged into one row to stay below)
+    */
+    void build(const ExperimentType & map, Size mz_bins = 4096, Size max_cells = 1 << 24);
+
+    /**
+      @brief Builds the pyramid from MS1 spectra read from disc
+
+      The m/z range of the pyramid is taken from @p spectra. Peaks outside of it are assigned to the first or last m/z bin.
+
+      @param spectra The spectra of an on-disc peak map
+      @param ms1_spectra Indices of the MS1 spectra (sorted by RT)
+      @param ms1_rts RTs of the MS1 spectra
+      @param mz_bins Number of m/z bins of the finest level
+      @param max_cells Maximum number of cells of the finest level (consecutive spectra are merged into one row to stay below)
+    */
+    void build(OnDiscSpectrumCache & spectra, const std::vector<Size> & ms1_spectra, const std::vector<DoubleReal> & ms1_rts, Size mz_bins = 4096, Size max_cells = 1 << 24);
+
+    /**
+      @brief Cancels build() and invalidates the pyramid
+
+      Stops and waits for a running build(), a later call of build() returns immediately.
+      Call this before changing the peak map the pyramid is (being) built from.
+    */
+    void cancel();
+
+    /// Returns if build() has finished
+    bool isReady() const;
+
+    /// Returns the number of levels (0 before build() has finished)
+    Size getLevelCount() const;
+
+    /**
+      @brief Computes the maximum intensity of the pixels of a view
+
+      The view [@p rt_min, @p rt_max) x [@p mz_min, @p mz_max) is cut into @p rt_pixel_count x @p mz_pixel_count pixels.
+      @p intensities holds the maximum intensity of each pixel afterwards (RT pixel major), or -1 for pixels without peaks.
+
+      If @p coarse is true, the finest level is used even if it is too coarse for the requested pixel size.
+      Its cells are painted into all pixels they overlap then.
+
+      @return false if the pyramid is not ready or too coarse for the requested pixel size
+    */
+    bool getMaximumIntensities(DoubleReal rt_min, DoubleReal rt_max, DoubleReal mz_min, DoubleReal mz_max, Size rt_pixel_count, Size mz_pixel_count, std::vector<Real> & intensities, bool coarse = false) const;
+
+protected:
+    /// One level of the pyramid
+    struct Level_
+    {
+      /// Number of rows (RT)
+      Size rows;
+      /// Number of columns (m/z)
+      Size columns;
+      /// Maximum intensity of each cell (row major), -1 for empty cells
+      std::vector<Real> intensities;
+    };
+
+    /// Clears the pyramid and allocates the finest level for (at most) @p spectrum_count spectra
+    void initialize_(Size spectrum_count, DoubleReal mz_min, DoubleReal mz_max, Size mz_bins, Size max_cells);
+
+    /// Adds the next MS1 spectrum to the finest level (empty spectra are skipped)
+    void addSpectrum_(const SpectrumType & spectrum, DoubleReal rt);
+
+    /// Computes the coarser levels and sets the ready flag
+    void finish_();
+
+    /// Returns if cancel() was called
+    bool isCancelled_() const;
+
+    /// RT of the MS1 spectra
+    std::vector<DoubleReal> rts_;
+    /// Number of spectra per row of the finest level
+    Size spectra_per_row_;
+    /// Start of the m/z range
+    DoubleReal mz_min_;
+    /// m/z width of the columns of the finest level
+    DoubleReal mz_bin_width_;
+    /// Levels, from fine to coarse
+    std::vector<Level_> levels_;
+    /// Flag set when build() has finished
+    bool ready_;
+    /// Flag set by cancel()
+    bool cancelled_;
+    /// Guards ready_ and cancelled_
+    mutable QMutex mutex_;
+    /// Held while build() runs
+    QMutex build_mutex_;
+
+private:
+    /// Not implemented
+    IntensityTilePyramid(const IntensityTilePyramid &);
+    /// Not implemented
+    IntensityTilePyramid & operator=(const IntensityTilePyramid &);
+  };
+
+}
+#endif // OPENMS_VISUAL_INTENSITYTILEPYRAMID_H
@@ -40,6 +40,8 @@
 #include <OpenMS/KERNEL/ConsensusMap.h>
 #include <OpenMS/DATASTRUCTURES/String.h>
 #include <OpenMS/VISUAL/MultiGradient.h>
+#include <OpenMS/VISUAL/IntensityTilePyramid.h>
+#include <OpenMS/VISUAL/OnDiscSpectrumCache.h>
 #include <OpenMS/VISUAL/ANNOTATION/Annotations1DContainer.h>
 #include <OpenMS/FILTERING/DATAREDUCTION/DataFilters.h>
 
@@ -119,6 +121,12 @@ public:
     /// SharedPtr on MSExperiment
     typedef boost::shared_ptr<ExperimentType> ExperimentSharedPtrType;
 
+    /// SharedPtr on the maximum intensity tiles of the peak data
+    typedef boost::shared_ptr<IntensityTilePyramid> IntensityTilesSharedPtrType;
+
+    /// SharedPtr on the spectrum cache of on-disc peak data
+    typedef boost::shared_ptr<OnDiscSpectrumCache> OnDiscSpectrumCacheSharedPtrType;
+
     //@}
 
     /// Default constructor
@@ -137,6 +145,8 @@ public:
       modifiable(false),
       modified(false),
       label(L_NONE),
+      intensity_tiles(),
+      on_disc_peaks(),
       features(new FeatureMapType()),
       consensus(new ConsensusMapType()),
       peaks(new ExperimentType()),
@@ -146,7 +156,7 @@ public:
       annotations_1d.resize(1);
     }
 
-    /// Returns a const reference to the current spectrum (1d view)
+    /// Returns a const reference to the current spectrum (1d view, the peaks of on-disc layers are read if needed)
     const ExperimentType::SpectrumType & getCurrentSpectrum() const;
 
     /// Returns a const reference to the current feature data
@@ -221,11 +231,16 @@ public:
       return annotations_1d[spectrum_index];
     }
 
-    /// Returns a mutable reference to the current spectrum (1d view)
-    ExperimentType::SpectrumType & getCurrentSpectrum()
-    {
-      return (*peaks)[current_spectrum_];
-    }
+    /// Returns a mutable reference to the current spectrum (1d view, the peaks of on-disc layers are read if needed)
+    ExperimentType::SpectrumType & getCurrentSpectrum();
+
+    /**
+      @brief Returns the peak data including the peaks of all spectra
+
+      For on-disc layers, all spectra are read from the file into a new experiment.
+      Use this for operations that need all peaks (storing, running tools), not for painting.
+    */
+    ExperimentSharedPtrType getFullPeakData() const;
 
     /// Get the index of the current spectrum
     Size getCurrentSpectrumIndex() const
@@ -304,6 +319,12 @@ public:
     /// Label type
     LabelType label;
 
+    /// Maximum intensity tiles of the peak data for the 2D view (built in the background, may be null)
+    IntensityTilesSharedPtrType intensity_tiles;
+
+    /// Spectrum cache of on-disc peak layers, null for layers held in memory. The peak data of on-disc layers holds the peaks of the cached spectra only.
+    OnDiscSpectrumCacheSharedPtrType on_disc_peaks;
+
 private:
     /// feature data
     FeatureMapSharedPtrType features;
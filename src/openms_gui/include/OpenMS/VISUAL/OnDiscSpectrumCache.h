@@ -0,0 +1,200 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// --------------------------------------------------------------------------
+// $Maintainer: Timo Sachsenberg $
+// $Authors: Timo Sachsenberg $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_VISUAL_ONDISCSPECTRUMCACHE_H
+#define OPENMS_VISUAL_ONDISCSPECTRUMCACHE_H
+
+//OpenMS
+#include <OpenMS/KERNEL/MSExperiment.h>
+#include <OpenMS/FORMAT/IndexedMzMLFile.h>
+
+//QT
+#include <QtCore/QMutex>
+#include <QtCore/QFuture>
+
+//STL
+#include <list>
+#include <map>
+#include <vector>
+
+//boost
+#include <boost/shared_ptr.hpp>
+
+namespace OpenMS
+{
+
+  /**
+      @brief Reads the peaks of an indexed mzML file on demand
+
+      Used for peak layers that are too large to be loaded completely. Only the meta data of the
+      spectra is loaded up front (see open()); it forms the peak map of the layer. The peaks of
+      single spectra are read from the file when they are needed (see load()) and removed from
+      the map again when more than getCapacity() spectra hold peaks. After each load(), the
+      neighbouring spectra are read in the background, so that scrolling through the spectra
+      or panning the view does not wait for the disc.
+
+      All methods taking the peak map have to be called from the thread owning the map (the GUI thread).
+      readSpectrum() may be called from any thread.
+
+      @ingroup Visual
+  */
+  class OPENMS_GUI_DLLAPI OnDiscSpectrumCache
+  {
+public:
+    /// Peak map type
+    typedef MSExperiment<> ExperimentType;
+    /// Spectrum type
+    typedef ExperimentType::SpectrumType SpectrumType;
+
+    /// Constructor
+    explicit OnDiscSpectrumCache(Size capacity = 1000);
+
+    /// Destructor (waits for reading in the background to finish)
+    ~OnDiscSpectrumCache();
+
+    /// Returns if @p filename is an mzML file with a valid index
+    static bool isIndexedMzML(const String & filename);
+
+    /**
+      @brief Opens the indexed mzML file @p filename and loads the meta data of its spectra into @p map
+
+      The spectra of @p map do not hold peaks afterwards. The ranges of the data are estimated from
+      the meta data of the spectra (or from some of the spectra, if the meta data is missing).
+
+      @exception Exception::FileNotFound is thrown if the file could not be opened
+      @exception Exception::ParseError is thrown if the file has no valid index or an error occurred while parsing it
+    */
+    void open(const String & filename, ExperimentType & map);
+
+    /// Returns the name of the opened file
+    const String & getFilename() const;
+
+    /// Returns the number of spectra of the opened file
+    Size size() const;
+
+    /// Sets the maximum number of spectra of the map that hold peaks
+    void setCapacity(Size capacity);
+
+    /// Returns the maximum number of spectra of the map that hold peaks
+    Size getCapacity() const;
+
+    /**
+      @brief Makes sure the spectra [@p begin, @p end) of @p map hold their peaks
+
+      Peaks of other spectra are removed from @p map, if more than getCapacity() spectra hold peaks.
+
+      @return false if the range contains more than getCapacity() spectra (nothing is read then)
+    */
+    bool load(ExperimentType & map, Size begin, Size end);
+
+    /// Makes sure spectrum @p index of @p map holds its peaks
+    void load(ExperimentType & map, Size index);
+
+    /// Copies the spectra [@p begin, @p end) of @p map with all their peaks and the experimental settings to @p out (without changing @p map)
+    void read(const ExperimentType & map, Size begin, Size end, ExperimentType & out);
+
+    /// Reads the peaks of spectrum @p index from the file (sorted by m/z, without touching the cache)
+    void readSpectrum(Size index, SpectrumType & spectrum);
+
+    /// @name Ranges of the data (estimated when opening the file, extended whenever a spectrum is read)
+    //@{
+    DoubleReal getMinRT() const;
+    DoubleReal getMaxRT() const;
+    DoubleReal getMinMZ() const;
+    DoubleReal getMaxMZ() const;
+    DoubleReal getMinInt() const;
+    DoubleReal getMaxInt() const;
+    //@}
+
+protected:
+    /// Reads the spectra [@p begin, @p end) in the background, unless they already hold peaks in the map
+    void prefetch_(Size begin, Size end);
+
+    /// Reads the spectra @p indices to prefetched_ (runs in the background)
+    void readPrefetched_(std::vector<Size> indices);
+
+    /// Cancels reading in the background and waits for it to finish
+    void cancelPrefetch_();
+
+    /// Marks spectrum @p index of @p map as recently used, reads it if needed
+    void touch_(ExperimentType & map, Size index);
+
+    /// Removes the peaks of the least recently used spectra of @p map, until @p count spectra hold peaks
+    void shrink_(ExperimentType & map, Size count);
+
+    /// Extends the ranges of the data by the peaks of @p spectrum
+    void extendRanges_(const SpectrumType & spectrum);
+
+    /// The indexed mzML file
+    boost::shared_ptr<IndexedMzMLFile> file_;
+    /// Name of the file
+    String filename_;
+    /// Number of spectra
+    Size size_;
+    /// Maximum number of spectra holding peaks
+    Size capacity_;
+    /// Spectra holding peaks in the map, most recently used first
+    std::list<Size> resident_;
+    /// Position of the spectra in resident_
+    std::map<Size, std::list<Size>::iterator> resident_positions_;
+    /// Spectra read in the background, not yet moved to the map
+    std::map<Size, SpectrumType> prefetched_;
+    /// Background reading
+    QFuture<void> prefetch_future_;
+    /// Flag telling the background reading to stop
+    volatile bool cancel_prefetch_;
+    /// @name Ranges of the data
+    //@{
+    DoubleReal min_rt_;
+    DoubleReal max_rt_;
+    DoubleReal min_mz_;
+    DoubleReal max_mz_;
+    DoubleReal min_int_;
+    DoubleReal max_int_;
+    //@}
+    /// Guards file_ (the file stream is not thread safe)
+    QMutex file_mutex_;
+    /// Guards prefetched_ and the ranges
+    mutable QMutex mutex_;
+
+private:
+    /// Not implemented
+    OnDiscSpectrumCache(const OnDiscSpectrumCache &);
+    /// Not implemented
+    OnDiscSpectrumCache & operator=(const OnDiscSpectrumCache &);
+  };
+
+}
+#endif // OPENMS_VISUAL_ONDISCSPECTRUMCACHE_H
@@ -137,6 +137,9 @@ protected slots:
     /// Reacts on changed layer paramters
     void currentLayerParametersChanged_();
 
+    /// Repaints after the intensity tiles of a layer have been built
+    void intensityTilesBuilt_();
+
 protected:
     // Docu in base class
     bool finishAdding_();
@@ -186,6 +189,25 @@ protected:
     */
     void paintMaximumIntensities_(Size layer_index, Size rt_pixel_count, Size mz_pixel_count, QPainter& p);
 
+    /**
+      @brief Paints the maximum intensity of each pixel from the precomputed intensity tiles of a layer.
+
+      Much faster than paintMaximumIntensities_() for large maps, as the time needed depends on the number
+      of pixels only. Filters are not applied, so the tiles are not used for filtered layers.
+
+      @param layer_index The index of the layer.
+      @param rt_pixel_count
+      @param mz_pixel_count
+      @param p The QPainter to paint on.
+      @param coarse If @em true, tiles coarser than the pixels are painted as well (for on-disc layers, when the visible spectra cannot be read).
+
+      @return false if the tiles are not available (yet) or too coarse for the current zoom level
+    */
+    bool paintIntensityTiles_(Size layer_index, Size rt_pixel_count, Size mz_pixel_count, QPainter& p, bool coarse = false);
+
+    /// Starts building the intensity tiles of the peak layer @p layer_index in the background
+    void buildIntensityTiles_(Size layer_index);
+
     /**
       @brief Paints the precursor peaks.
 
@@ -340,6 +362,13 @@ protected:
     /// Highlights a single peak and prints coordinates to screen
     void highlightPeak_(QPainter& p, const PeakIndex& peak);
 
+    /**
+      @brief Makes sure the spectrum of @p peak holds its peaks again, if it belongs to an on-disc layer
+
+      The peaks of spectra that are not visible are removed from on-disc layers. @p peak is cleared if it does not exist (anymore).
+    */
+    void reloadPeak_(PeakIndex& peak);
+
     /// Returns the nearest peak to position @p pos
     PeakIndex findNearestPeak_(const QPoint& pos);
 
@@ -345,10 +345,11 @@ public:
 
   @param map Shared Pointer to input map. It can be performed in constant time and does not double the required memory.
         @param filename This @em absolute filename is used to monitor changes in the file and reload the data
+        @param on_disc_peaks Spectrum cache, if @p map holds the meta data of an on-disc peak map only (see OnDiscSpectrumCache)
 
         @return If a new layer was created
     */
-    bool addLayer(ExperimentSharedPtrType map, const String & filename = "");
+    bool addLayer(ExperimentSharedPtrType map, const String & filename = "", LayerData::OnDiscSpectrumCacheSharedPtrType on_disc_peaks = LayerData::OnDiscSpectrumCacheSharedPtrType());
 
     /**
         @brief Add a feature data layer
@@ -419,7 +420,11 @@ public:
     /// Returns the minimum intensity of the layer with index @p index
     inline Real getMinIntensity(Size index) const
     {
-      if (getLayer(index).type == LayerData::DT_PEAK || getCurrentLayer().type == LayerData::DT_CHROMATOGRAM)
+      if (getLayer(index).on_disc_peaks)
+      {
+        return getLayer(index).on_disc_peaks->getMinInt();
+      }
+      else if (getLayer(index).type == LayerData::DT_PEAK || getCurrentLayer().type == LayerData::DT_CHROMATOGRAM)
       {
         return getLayer(index).getPeakData()->getMinInt();
       }
@@ -436,7 +441,11 @@ public:
     /// Returns the maximum intensity of the layer with index @p index
     inline Real getMaxIntensity(Size index) const
     {
-      if (getLayer(index).type == LayerData::DT_PEAK || getCurrentLayer().type == LayerData::DT_CHROMATOGRAM)
+      if (getLayer(index).on_disc_peaks)
+      {
+        return getLayer(index).on_disc_peaks->getMaxInt();
+      }
+      else if (getLayer(index).type == LayerData::DT_PEAK || getCurrentLayer().type == LayerData::DT_CHROMATOGRAM)
       {
         return getLayer(index).getPeakData()->getMaxInt();
       }
@@ -0,0 +1,186 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Johannes Junker $
+// $Authors: Johannes Junker $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_VISUAL_TOPPASRESULTCACHE_H
+#define OPENMS_VISUAL_TOPPASRESULTCACHE_H
+
+#include <OpenMS/config.h>
+#include <OpenMS/DATASTRUCTURES/Map.h>
+#include <OpenMS/DATASTRUCTURES/String.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+      @brief Content-addressed cache of the output files of TOPP tool calls
+
+      Each tool call of a pipeline is identified by a key (see computeKey()), which is the SHA-1
+      hash of the tool name and version, the effective parameters, the content of all input files
+      and the names of the output files. After a successful call, the output files are stored in
+      a subdirectory of the cache directory named after the key. When the same call is about to
+      be made again (e.g. after a parameter of a downstream tool was changed), its outputs are
+      taken from the cache instead and the tool is not run at all.
+
+      Files are hard-linked into and out of the cache where the file system supports it, so
+      caching costs neither time nor disk space. Otherwise, they are copied.
+
+      The size of the cache can be limited (see setSizeLimit()). When a call is stored, the
+      least recently used calls are removed until the files of the cache fit into the limit.
+      The size of hard-linked files is counted in full, although their space is shared with the
+      output files of the pipeline.
+
+      The hashes of input files are remembered (by path, size and modification time), so each
+      file is read only once per session.
+
+      @ingroup TOPPAS_elements
+  */
+  class OPENMS_GUI_DLLAPI TOPPASResultCache
+  {
+public:
+
+    /// Constructor (the cache is disabled until a directory is set)
+    TOPPASResultCache();
+    /// Destructor
+    virtual ~TOPPASResultCache();
+
+    /// Sets the cache directory (an empty string disables the cache)
+    void setDirectory(const String & directory);
+    /// Returns the cache directory
+    const String & getDirectory() const;
+    /// Returns if the cache is enabled, i.e. if a directory is set
+    bool isEnabled() const;
+
+    /// Sets the maximum size of the cache in MB (0 = unlimited, the default)
+    void setSizeLimit(Size size_limit);
+    /// Returns the maximum size of the cache in MB (0 = unlimited)
+    Size getSizeLimit() const;
+
+    /// Returns the size of all files in the cache (in bytes)
+    Int64 getSize() const;
+
+    /**
+      @brief Removes all calls from the cache
+
+      @return false if the cache is disabled or a file could not be removed
+    */
+    bool clear();
+
+    /**
+      @brief Computes the key of a tool call
+
+      @param description Everything but the input files that determines the outputs of the call (tool, version, parameters, output names)
+      @param input_files The input files of the call, in a fixed order
+
+      @exception Exception::FileNotFound is thrown if an input file does not exist
+    */
+    String computeKey(const String & description, const std::vector<String> & input_files);
+
+    /**
+      @brief Materializes the cached outputs of call @p key as @p output_files
+
+      Existing files are replaced. Counts a hit or a miss. A hit marks the call as recently used.
+
+      @return true if all outputs were found in the cache (and materialized), false otherwise
+    */
+    bool lookup(const String & key, const std::vector<String> & output_files);
+
+    /**
+      @brief Stores the outputs @p output_files of call @p key in the cache
+
+      Nothing happens if the call is cached already. Afterwards, least recently used calls are
+      removed if the cache exceeds the size limit.
+
+      @return true on success
+    */
+    bool store(const String & key, const std::vector<String> & output_files);
+
+    /// Returns the SHA-1 hash of the content of file @p filename (remembered by path, size and modification time)
+    String getFileHash(const String & filename);
+
+    /// @name Statistics
+    //@{
+    /// Number of lookups which found the outputs in the cache
+    Size getHits() const;
+    /// Number of lookups which did not find the outputs in the cache
+    Size getMisses() const;
+    /// Number of calls stored in the cache
+    Size getStored() const;
+    /// Resets the statistics
+    void resetStatistics();
+    //@}
+
+    /// Returns the default cache directory (in the home directory of the user)
+    static String getDefaultDirectory();
+    /// Returns the default size limit in MB, used together with the default directory
+    static Size getDefaultSizeLimit();
+
+    /// Creates @p to as a hard link to @p from, or as a copy if that fails. An existing file @p to is replaced.
+    static bool linkOrCopy(const String & from, const String & to);
+
+protected:
+
+    /// Returns the directory of call @p key
+    String getEntryDirectory_(const String & key) const;
+
+    /// Marks the call in directory @p entry as used now
+    void touch_(const String & entry) const;
+
+    /**
+      @brief Lists the calls in the cache
+
+      @param entries The size (in bytes) and directory of each call, sorted by time of last use (least recently used first)
+      @return The size of all calls (in bytes)
+    */
+    Int64 listEntries_(std::vector<std::pair<Int64, String> > & entries) const;
+
+    /// Removes least recently used calls until the cache fits into the size limit
+    void shrink_();
+
+    /// The cache directory
+    String directory_;
+    /// Maximum size of the cache in MB (0 = unlimited)
+    Size size_limit_;
+    /// Remembered hashes of files: path -> (size and modification time, hash)
+    Map<String, std::pair<String, String> > file_hashes_;
+    /// Number of hits
+    Size hits_;
+    /// Number of misses
+    Size misses_;
+    /// Number of stored calls
+    Size stored_;
+  };
+}
+
+#endif
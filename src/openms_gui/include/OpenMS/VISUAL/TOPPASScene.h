@@ -39,9 +39,15 @@
 #include <OpenMS/VISUAL/TOPPASEdge.h>
 #include <OpenMS/DATASTRUCTURES/String.h>
 #include <OpenMS/VISUAL/TOPPASToolVertex.h>
+#include <OpenMS/VISUAL/TOPPASToolProfiles.h>
+#include <OpenMS/VISUAL/TOPPASResultCache.h>
+#include <OpenMS/DATASTRUCTURES/Map.h>
 
 #include <QtGui/QGraphicsScene>
 #include <QtCore/QProcess>
+#include <QtCore/QTime>
+
+class QTimer;
 
 namespace OpenMS
 {
@@ -76,6 +82,16 @@ public:
       be indicated via the constructor. In this case, the signals for log message output are connected
       to standard out. This is utilized for the ExecutePipeline tool.
 
+      Pending tool calls are started as long as threads are available (see setAllowedThreads()) and
+      their memory consumption fits into the memory limit (see setMemoryLimit()). Calls on the longest
+      remaining path through the pipeline are started first. Tools whose "threads" parameter is larger
+      than one get as many of the idle threads as they ask for. Runtime and memory consumption of the
+      tools are learned from previous runs (see TOPPASToolProfiles).
+
+      If the result cache is enabled (see getResultCache()), tool calls whose input files, parameters
+      and tool version did not change since an earlier run are not executed again. Their outputs are
+      taken from the cache instead.
+
   Temporary files of the pipeline are stored in the member tmp_path_. Update it when loading a pipeline which has
   tmp data from an old run. TOPPASToolVertex will ask its parent scene() whenever it wants to know the tmp directory.
 
@@ -96,7 +112,12 @@ public:
         proc(p),
         command(cmd),
         args(arg),
-        tv(tool)
+        tv(tool),
+        threads(1),
+        memory(0.0),
+        priority(0.0),
+        started(),
+        peak_memory(0.0)
       {
       }
 
@@ -108,6 +129,16 @@ public:
       QStringList args;
       /// The tool which is started (used to call its slots)
       TOPPASToolVertex * tv;
+      /// The number of threads (requested by the tool while pending, assigned while running)
+      int threads;
+      /// The estimated memory consumption in MB (0 if unknown)
+      DoubleReal memory;
+      /// The estimated runtime of the longest path from the tool to the end of the pipeline (processes on longer paths are started first)
+      DoubleReal priority;
+      /// The start time
+      QTime started;
+      /// The peak memory consumption in MB measured so far
+      DoubleReal peak_memory;
     };
 
     /// The current action mode (creation of a new edge, or panning of the widget)
@@ -235,8 +266,18 @@ public:
     QString getDescription() const;
     /// when description is updated by user, use this to update the description for later storage in file
     void setDescription(const QString & desc);
-    /// sets the maximum number of jobs
+    /// sets the maximum number of threads used by the jobs running in parallel (single threaded tools use one each)
     void setAllowedThreads(int num_threads);
+    /// sets the memory (in MB) the jobs running in parallel may use according to their profiles (0 = unlimited)
+    void setMemoryLimit(DoubleReal memory_limit);
+    /// returns the memory limit in MB (0 = unlimited)
+    DoubleReal getMemoryLimit() const;
+    /// returns the runtime and memory profiles of the tools, learned from previous runs
+    const TOPPASToolProfiles & getToolProfiles() const;
+    /// returns the cache of tool call outputs (mutable access, e.g. to enable it by setting a directory)
+    TOPPASResultCache & getResultCache();
+    /// returns the cache of tool call outputs
+    const TOPPASResultCache & getResultCache() const;
     /// returns the hovering edge
     TOPPASEdge* getHoveringEdge();
     /// Checks whether all output vertices are finished, and if yes, emits entirePipelineFinished() (called by finished output vertices)
@@ -268,8 +309,8 @@ public slots:
     void setPipelineRunning(bool b = true);
     /// Invoked by TTV or other vectices if a parameter was edited
     void changedParameter(const bool invalidates_running_pipeline);
-    /// Called by a finished QProcess to indicate that we are free to start a new one
-    void processFinished();
+    /// Called by a finished QProcess to indicate that we are free to start a new one (@p success indicates if the tool exited normally)
+    void processFinished(QProcess * process, bool success);
     /// dirty solution: when using ExecutePipeline this slot is called when the pipeline crashes. This will quit the app
     void quitWithError();
 
@@ -314,6 +355,11 @@ signals:
     void messageReady(const QString & msg);
 
 
+protected slots:
+
+    /// Measures the peak memory consumption of the running processes
+    void measureMemory_();
+
 protected:
 
     /// The current action mode
@@ -354,6 +400,20 @@ protected:
     QString description_text_;
     /// maximum number of allowed threads
     int allowed_threads_;
+    /// The running TOPP processes
+    QList<TOPPProcess> running_processes_;
+    /// maximum memory (in MB) of the running processes (0 = unlimited)
+    DoubleReal memory_limit_;
+    /// estimated memory (in MB) of the running processes
+    DoubleReal memory_active_;
+    /// runtime and memory profiles of the tools
+    TOPPASToolProfiles tool_profiles_;
+    /// estimated runtime of the longest path from a vertex to the end of the pipeline (computed on demand)
+    Map<TOPPASVertex *, DoubleReal> critical_paths_;
+    /// timer for measuring the memory consumption of the running processes
+    QTimer * memory_timer_;
+    /// cache of tool call outputs
+    TOPPASResultCache result_cache_;
     /// last node where 'resume' was started
     TOPPASToolVertex* resume_source_;
 
@@ -363,6 +423,10 @@ protected:
     bool isEdgeAllowed_(TOPPASVertex * u, TOPPASVertex * v);
     /// DFS helper method. Returns true, if a back edge has been discovered
     bool dfsVisit_(TOPPASVertex * vertex);
+    /// Returns the estimated runtime of the longest path from @p vertex to the end of the pipeline
+    DoubleReal getCriticalPath_(TOPPASVertex * vertex);
+    /// Returns the key of the profile of tool @p tool
+    static String getProfileKey_(const TOPPASToolVertex * tool);
     /// Performs a sanity check of the pipeline and notifies user when it finds something strange. Returns if pipeline OK.
     /// if 'allowUserOverride' is true, some dialogs are shown which allow the user to ignore some warnings (e.g. disconnected nodes)
     bool sanityCheck_(bool allowUserOverride);
@@ -374,6 +438,8 @@ protected:
 
     ///Writes the @p text to the logfile
     void writeToLogFile_(const QString & text);
+    ///Writes the statistics of the result cache to the logfile (if the cache is enabled)
+    void logResultCacheStatistics_();
   };
 
 }
@@ -0,0 +1,115 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Johannes Junker $
+// $Authors: Johannes Junker $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_VISUAL_TOPPASTOOLPROFILES_H
+#define OPENMS_VISUAL_TOPPASTOOLPROFILES_H
+
+#include <OpenMS/config.h>
+#include <OpenMS/DATASTRUCTURES/Map.h>
+#include <OpenMS/DATASTRUCTURES/String.h>
+
+namespace OpenMS
+{
+  /**
+      @brief Runtime and memory consumption of TOPP tools, learned from previous pipeline runs
+
+      The TOPPASScene uses the profiles to schedule the tool calls of a pipeline: the runtimes
+      determine the critical path through the pipeline, the memory consumption determines which
+      tools can run in parallel without exceeding the memory limit.
+
+      Each finished tool call updates the profile of its tool by an exponential moving average,
+      so the profiles follow changes of the data or the parameters over time.
+
+      @ingroup TOPPAS_elements
+  */
+  class OPENMS_GUI_DLLAPI TOPPASToolProfiles
+  {
+public:
+
+    /// Profile of a single tool
+    struct Profile
+    {
+      /// Constructor
+      Profile();
+
+      /// Number of recorded calls
+      UInt runs;
+      /// Runtime in seconds
+      DoubleReal runtime;
+      /// Peak memory consumption in MB (0 if unknown)
+      DoubleReal memory;
+    };
+
+    /// Constructor
+    TOPPASToolProfiles();
+    /// Destructor
+    virtual ~TOPPASToolProfiles();
+
+    /// Returns the profile of tool @p tool (a default profile if nothing has been recorded)
+    const Profile & get(const String & tool) const;
+    /// Returns if a profile for tool @p tool has been recorded
+    bool has(const String & tool) const;
+    /**
+      @brief Records a call of tool @p tool
+
+      @param tool The tool name (plus type, if any)
+      @param runtime The runtime in seconds
+      @param memory The peak memory consumption in MB (0 if it could not be measured, the recorded value is kept then)
+    */
+    void add(const String & tool, DoubleReal runtime, DoubleReal memory);
+    /// Returns the number of tools with a profile
+    Size size() const;
+    /// Clears all profiles
+    void clear();
+
+    /// Loads the profiles from file @p file_name (nothing happens if the file does not exist)
+    void load(const String & file_name);
+    /// Writes the profiles to file @p file_name
+    void store(const String & file_name) const;
+
+    /// Returns the default file of the profiles (in the home directory of the user)
+    static String getDefaultFile();
+    /// Returns the peak memory consumption (in MB) of the running process with id @p pid, or 0 if it cannot be determined on this platform
+    static DoubleReal getPeakMemory(Int64 pid);
+
+protected:
+
+    /// The profiles
+    Map<String, Profile> profiles_;
+    /// The default profile
+    Profile default_profile_;
+  };
+}
+
+#endif
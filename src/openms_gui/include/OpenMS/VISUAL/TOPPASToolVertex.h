@@ -235,6 +235,15 @@ protected:
     void getParameters_(QVector<IOInfo> & io_infos, bool input_params) const;
     /// Writes @p param to the @p ini_file
     void writeParam_(const Param & param, const QString & ini_file);
+    /**
+      @brief Computes the result cache key of one tool call
+
+      The key covers the tool and its version, the parameters @p param (without input and output file parameters),
+      the content of the input files in @p inputs and of other files given as input file parameters, and the names
+      of the output files in @p outputs (which are also stored in @p output_files).
+      Returns an empty string if the key cannot be computed (e.g. because an input file is missing).
+    */
+    String computeCacheKey_(const RoundPackage & inputs, const RoundPackage & outputs, const Param & param, const QVector<IOInfo> & in_params, const QVector<IOInfo> & out_params, std::vector<String> & output_files);
     /// Helper method for finding good boundaries for wrapping the tool name. Returns a string with whitespaces at the preferred boundaries.
     QString toolnameWithWhitespacesForFancyWordWrapping_(QPainter * painter, const QString & str);
 
@@ -257,6 +266,9 @@ protected:
     /// Breakpoint set?
     bool breakpoint_set_;
 
+    /// Result cache key and output files of the running tool calls
+    std::map<QProcess *, std::pair<String, std::vector<String> > > cache_entries_;
+
     /// smart naming of round-based filenames
     /// when basename is not unique we take the preceding directory name
     void smartFileNames_(std::vector< QStringList >& filenames);
@@ -64,10 +64,12 @@ AxisWidget.h
 ColorSelector.h
 EnhancedTabBar.h
 HistogramWidget.h
+IntensityTilePyramid.h
 LayerData.h
 MetaDataBrowser.h
 MultiGradient.h
 MultiGradientSelector.h
+OnDiscSpectrumCache.h
 ParamEditor.h
 SpectraViewWidget.h
 SpectraIdentificationViewWidget.h
@@ -93,6 +95,8 @@ TOPPASTabBar.h
 TOPPASTreeView.h
 TOPPASResource.h
 TOPPASResources.h
+TOPPASResultCache.h
+TOPPASToolProfiles.h
 TOPPViewBehaviorInterface.h
 TOPPViewIdentificationViewBehavior.h
 TOPPViewSpectraViewBehavior.h
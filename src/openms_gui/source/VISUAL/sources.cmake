@@ -9,10 +9,12 @@ AxisWidget.C
 ColorSelector.C
 EnhancedTabBar.C
 HistogramWidget.C
+IntensityTilePyramid.C
 LayerData.C
 MetaDataBrowser.C
 MultiGradient.C
 MultiGradientSelector.C
+OnDiscSpectrumCache.C
 ParamEditor.C
 SpectraViewWidget.C
 SpectraIdentificationViewWidget.C
@@ -39,6 +41,8 @@ TOPPASTabBar.C
 TOPPASTreeView.C
 TOPPASResource.C
 TOPPASResources.C
+TOPPASResultCache.C
+TOPPASToolProfiles.C
 TOPPViewBehaviorInterface.C
 TOPPViewIdentificationViewBehavior.C
 TOPPViewSpectraViewBehavior.C
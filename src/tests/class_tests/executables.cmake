@@ -112,6 +112,7 @@ set(kernel_executables_list
 	DPeak_test
 	DRichPeak_test
 	FeatureMap_test
+	FeatureTable_test
 	Feature_test
 	MassTrace_test
   MRMFeature_test
@@ -131,12 +132,17 @@ set(kernel_executables_list
 
 set(visual_executables_list
   AxisTickCalculator_test
+  IntensityTilePyramid_test
   MultiGradient_test
+  OnDiscSpectrumCache_test
+  TOPPASResultCache_test
+  TOPPASToolProfiles_test
 )
 
 set(format_executables_list
   Base64_test
   BigString_test
+  BinaryMapFile_test
   Bzip2Ifstream_test
   Bzip2InputStream_test
   CVMappingFile_test
@@ -148,6 +154,7 @@ set(format_executables_list
   DTAFile_test
   EDTAFile_test
   FASTAFile_test
+  FASTAIndexFile_test
   FeatureXMLFile_test
   FileHandler_test
   FileTypes_test
@@ -161,6 +168,7 @@ set(format_executables_list
   LibSVMEncoder_test
   MS2File_test
   MSPFile_test
+  MappedIndexFile_test
   MascotGenericFile_test
   MascotInfile_test
   MascotRemoteQuery_test
@@ -194,6 +202,7 @@ set(format_executables_list
   SequestInfile_test
   SequestOutfile_test
   SpecArrayFile_test
+  SpectralLibraryIndexFile_test
   TextFile_test
   ToolDescriptionFile_test
   TraMLFile_test
@@ -10,6 +10,7 @@ DecoyDatabase
 Digestor
 DigestorMotif
 ERPairFinder
+FASTAIndexer
 FeatureFinderSuperHirn
 FFEval
 FuzzyDiff